@@ -52,6 +52,8 @@ void DIO_setPinDirection(const DioConfig* a_CONFIG_MSG_Ptr)
 		/* clear the corresponding bit in the DDR register to configure it as INPUT pin */
 		CLEARBIT(*ddr_Ptr,a_CONFIG_MSG_Ptr->s_pinNum);
 	}				
+	/* end of the access on the host emulation, nothing on the target */
+	DIO_HOST_ACCESS();
 }
 
 /*---------------------------------------- DIO_Write_Pin ----------------------------------------*/
@@ -93,6 +95,8 @@ void DIO_writePin(const DioConfig* a_STATE_Ptr)
 		/* clear the corresponding pin in the PORT register */
         CLEARBIT(*port_Ptr,a_STATE_Ptr->s_pinNum); 
 	}		
+	/* end of the access on the host emulation, nothing on the target */
+	DIO_HOST_ACCESS();
 }
 
 /*----------------------------------------- DIO_Read_Pin ----------------------------------------*/
@@ -102,6 +106,8 @@ uint8 DIO_readPin(const DioConfig* a_STATE_Ptr)
 	uint8* pin_Ptr;
 	/* local uint8 which indicated whether the PIN is setted or cleared */
 	uint8 pinStatus;
+	/* the host emulation updates the PIN registers, nothing on the target */
+	DIO_HOST_ACCESS();
 	/* point to the required PIN Register */
 	switch(a_STATE_Ptr->s_port)
 	{
@@ -187,6 +193,8 @@ void DIO_setPortDirection(const DioConfig* a_CONFIG_MSG_Ptr)
 			CLEARBIT(*ddr_Ptr, pinCounter);
 		}
 	}
+	/* end of the access on the host emulation, nothing on the target */
+	DIO_HOST_ACCESS();
 }
 
 /*---------------------------------------- DIO_Write_Pin ----------------------------------------*/
@@ -220,6 +228,8 @@ void DIO_writePort(const DioConfig* a_STATE_Ptr)
 	}
 	/* OUT the port value */
 	*port_Ptr = a_STATE_Ptr->s_value;
+	/* end of the access on the host emulation, nothing on the target */
+	DIO_HOST_ACCESS();
 }
 
 /*----------------------------------------- DIO_Read_Pin ----------------------------------------*/
@@ -229,6 +239,8 @@ uint8 DIO_readPort(const DioConfig* a_STATE_Ptr)
 	uint8* pin_Ptr;
 	/* local uint8 which indicated whether the PIN is setted or cleared */
 	uint8 portValue;
+	/* the host emulation updates the PIN registers, nothing on the target */
+	DIO_HOST_ACCESS();
 	/* point to the required PIN Register */
 	switch(a_STATE_Ptr->s_port)
 	{
@@ -31,6 +31,15 @@
 #define LOGIC_HIGH 1
 #define LOGIC_LOW 0
 
+/*	each DIO function ends with a call to the host emulation to advance its simulated time and update its PIN
+*	registers, see host_emu.h, it is empty on the target
+*/
+#ifdef HOST_EMULATION
+#define DIO_HOST_ACCESS()	HOST_gpioAccess()
+#else
+#define DIO_HOST_ACCESS()
+#endif
+
 /*-------------------------------------- Structures and Unions ---------------------------------------*/
 /* ---------------------------------------------------------------------------------------------------
 Structure Name]: DioConfig
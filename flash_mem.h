@@ -0,0 +1,67 @@
+/* ---------------------------------------------------------------------------------------------------
+[FILE NAME]: <flash_mem.h>
+[AUTHOR(S)]: <Ayman Younis>
+[DATE CREATED]: <18/10/2026>
+[DESCRIPTION]: <This file contains the macros which are used to keep constant tables in the program memory
+				(flash) instead of copying them to the RAM at startup, and to read them back byte by byte.
+				The AVR reads its flash with the LPM instruction, a normal pointer dereference reads the RAM
+				at the same address, so a FLASH_CONST table must always be read with FLASH_READ_BYTE>
+--------------------------------------------------------------------------------------------------- */
+
+#ifndef FLASH_MEM_H_
+#define FLASH_MEM_H_
+
+/*---------------------------------- Definitions and configurations --------------------------------*/
+/*	HOST_EMULATION builds the drivers for the PC, the flash tables are then normal constant tables */
+#ifdef HOST_EMULATION
+
+/*	FLASH_CONST is put after the name of a constant table: static const uint8 table[4] FLASH_CONST = {..}; */
+#define FLASH_CONST
+
+/* ---------------------------------------------------------------------------------------------------
+[MACRO Name] : FLASH_READ_BYTE
+[Description] : This macro is responsible for reading one byte of a FLASH_CONST table
+[Args] : ADDRESS which refers to the address of the byte, &table[index] for example
+
+--------------------------------------------------------------------------------------------------- */
+#define FLASH_READ_BYTE(ADDRESS)	(*(const uint8*)(ADDRESS))
+
+/* ---------------------------------------------------------------------------------------------------
+[MACRO Name] : FLASH_READ_WORD
+[Description] : This macro is responsible for reading one uint16 of a FLASH_CONST table
+[Args] : ADDRESS which refers to the address of the uint16, &table[index] for example
+
+--------------------------------------------------------------------------------------------------- */
+#define FLASH_READ_WORD(ADDRESS)	(*(const uint16*)(ADDRESS))
+
+/* ---------------------------------------------------------------------------------------------------
+[MACRO Name] : FLASH_READ_DWORD
+[Description] : This macro is responsible for reading one uint32 of a FLASH_CONST table
+[Args] : ADDRESS which refers to the address of the uint32, &table[index] for example
+
+--------------------------------------------------------------------------------------------------- */
+#define FLASH_READ_DWORD(ADDRESS)	(*(const uint32*)(ADDRESS))
+
+/* ---------------------------------------------------------------------------------------------------
+[MACRO Name] : FLASH_READ_PTR
+[Description] : This macro is responsible for reading one pointer of a FLASH_CONST table, it is returned as
+				const void* and cast to the pointer type of the table member
+[Args] : ADDRESS which refers to the address of the pointer, &table[index].member for example
+
+--------------------------------------------------------------------------------------------------- */
+#define FLASH_READ_PTR(ADDRESS)		(*(const void* const*)(ADDRESS))
+
+#else
+
+#include <avr/pgmspace.h>
+
+#define FLASH_CONST					PROGMEM
+#define FLASH_READ_BYTE(ADDRESS)	((uint8)pgm_read_byte(ADDRESS))
+#define FLASH_READ_WORD(ADDRESS)	((uint16)pgm_read_word(ADDRESS))
+#define FLASH_READ_DWORD(ADDRESS)	((uint32)pgm_read_dword(ADDRESS))
+/*	the data and code pointers of the AVR are 16-bit */
+#define FLASH_READ_PTR(ADDRESS)		((const void*)pgm_read_word(ADDRESS))
+
+#endif
+
+#endif /*flash_mem.h*/
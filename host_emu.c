@@ -0,0 +1,641 @@
+/* --------------------------------------------------------------------------------------------------
+[FILE NAME]:		<host_emu.c>
+[AUTHOR(S)]:		<Ayman Younis>
+[DATE CREATED]:		<18/10/2026>
+[DESCRIPTION]:		This file contains the host emulation source file, the emulated registers, the simulated time
+*					and the observers of the DIO accesses, it is only built for the PC with HOST_EMULATION defined.
+[USAGE]:			<See the C include host_emu.h file for a description of each function>
+-------------------------------------------------------------------------------------------------- */
+
+/*--------------------------------------------- INCLUDES ------------------------------------------*/
+#define HOST_EMU_H_MAIN
+#include "dio.h"
+
+/*-------------------------------------- Structures and Unions ---------------------------------------*/
+/* ---------------------------------------------------------------------------------------------------
+[Structure Name]: HostLcd
+[Structure Description]: This structure is the state of one emulated controller:
+								1. s_pins, s_attached: its wiring, s_attached is 0 until HOST_lcdAttach
+								2. s_en: last level of its enable pin
+								3. s_mode8, s_lines2: interface and number of lines of the last function set
+								4. s_phase, s_high: nibble count and high nibble of a byte in 4-bit mode
+								5. s_entryMode: the last entry mode instruction
+								6. s_address, s_cgram: the address counter, s_cgram is 1 if it points to the CGRAM
+								7. s_ddram: the characters of the display data RAM
+---------------------------------------------------------------------------------------------------- */
+typedef struct
+{
+	HostLcdPins s_pins;
+	uint8 s_attached;
+	uint8 s_en;
+	uint8 s_mode8;
+	uint8 s_lines2;
+	uint8 s_phase;
+	uint8 s_high;
+	uint8 s_entryMode;
+	uint8 s_address;
+	uint8 s_cgram;
+	uint8 s_ddram[HOST_LCD_DDRAM];
+}HostLcd;
+
+/*------------------------------------------ Global Variables ------------------------------------------*/
+volatile uint8 g_hostReg[HOST_REGISTERS];
+
+/* ---------------------------------------------------------------------------------------------------
+[Variable Name]: g_s_hostTime
+[Variable Description]: The simulated time in nano seconds
+---------------------------------------------------------------------------------------------------- */
+static HostTime g_s_hostTime;
+
+/* ---------------------------------------------------------------------------------------------------
+[Variable Name]: g_s_hostAccesses
+[Variable Description]: The number of DIO accesses
+---------------------------------------------------------------------------------------------------- */
+static uint32 g_s_hostAccesses;
+
+/* ---------------------------------------------------------------------------------------------------
+[Variable Name]: g_s_hostInput
+[Variable Description]: The levels driven by the outside world on the input pins of each port
+---------------------------------------------------------------------------------------------------- */
+static uint8 g_s_hostInput[4];
+
+/* ---------------------------------------------------------------------------------------------------
+[Variable Name]: g_s_hostObserver, g_s_hostObservers
+[Variable Description]: The functions called after each DIO access and their number
+---------------------------------------------------------------------------------------------------- */
+static void (*g_s_hostObserver[HOST_MAX_OBSERVERS])(void);
+static uint8 g_s_hostObservers;
+
+/* ---------------------------------------------------------------------------------------------------
+[Variable Name]: g_s_hostPorts
+[Variable Description]: The PORT, DDR and PIN register addresses of ports A to D
+---------------------------------------------------------------------------------------------------- */
+static const uint8 g_s_hostPorts[4][3] =
+{
+	{0x3B, 0x3A, 0x39},
+	{0x38, 0x37, 0x36},
+	{0x35, 0x34, 0x33},
+	{0x32, 0x31, 0x30},
+};
+
+/* ---------------------------------------------------------------------------------------------------
+[Variable Name]: g_s_hostLcd
+[Variable Description]: The emulated controllers
+---------------------------------------------------------------------------------------------------- */
+static HostLcd g_s_hostLcd[HOST_LCD_MAX];
+
+/*-------------------------------------- Static FUNCTION DECLARATIONS --------------------------------------------*/
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : HOST_updatePins
+[Description] :	This function is responsible for updating the PIN registers from the PORT registers of the output
+				pins and the external levels of the input pins
+
+[Args] : This function takes no arguments
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+static void HOST_updatePins(void);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : HOST_lcdSample
+[Description] :	This function is responsible for following the enable edges of the emulated controllers after a DIO
+				access, a byte is read or written on the falling edge and a read drives the data pins from the
+				rising edge
+
+[Args] : This function takes no arguments
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+static void HOST_lcdSample(void);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : HOST_lcdExecute
+[Description] :	This function is responsible for executing one instruction or data write of an emulated controller
+
+[Args] :
+[in] HostLcd* a_lcd_Ptr, uint8 a_rs, uint8 a_value:
+a_lcd_Ptr: the emulated controller
+a_rs: LOGIC_HIGH for a data write, LOGIC_LOW for an instruction
+a_value: the byte written
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+static void HOST_lcdExecute(HostLcd* a_lcd_Ptr, uint8 a_rs, uint8 a_value);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : HOST_lcdMove
+[Description] :	This function is responsible for moving the address counter of an emulated controller by one place,
+				from the end of a line it goes where the number of lines of the function set leads
+
+[Args] :
+[in] HostLcd* a_lcd_Ptr, uint8 a_increment:
+a_lcd_Ptr: the emulated controller
+a_increment: 1 to move to the next address, 0 to the previous one
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+static void HOST_lcdMove(HostLcd* a_lcd_Ptr, uint8 a_increment);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : HOST_lcdDrive
+[Description] :	This function is responsible for driving the data pins of an emulated controller with the byte or
+				nibble of a read
+
+[Args] :
+[in] HostLcd* a_lcd_Ptr, uint8 a_value:
+a_lcd_Ptr: the emulated controller
+a_value: the nibble or byte, bit 0 is driven on s_data[0]
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+static void HOST_lcdDrive(HostLcd* a_lcd_Ptr, uint8 a_value);
+
+/*------------------------------------- FUNCTION Definitions --------------------------------------*/
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : HOST_gpioAccess
+[Description] :	This function is responsible for ending one DIO access, it advances the simulated time by
+				HOST_GPIO_CYCLES, updates the PIN registers from the PORT registers of the output pins and the
+				external levels of the input pins, follows the emulated controllers, then calls the observers
+
+[Args] : This function takes no arguments
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+void HOST_gpioAccess(void)
+{
+	uint8 loop;
+
+	g_s_hostAccesses++;
+	HOST_delayCycles(HOST_GPIO_CYCLES);
+	HOST_updatePins();
+	HOST_lcdSample();
+	for (loop=0;loop<g_s_hostObservers;loop++)
+	{
+		g_s_hostObserver[loop]();
+	}
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : HOST_setInput
+[Description] :	This function is responsible for setting the levels driven by the outside world on a port, they are
+				read in the PIN register for the pins configured as input
+
+[Args] :
+[in] uint8 a_port, uint8 a_value:
+a_port: 'A', 'B', 'C' or 'D'
+a_value: level of each pin of the port
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+void HOST_setInput(uint8 a_port, uint8 a_value)
+{
+	uint8 port = (uint8)((a_port | 0x20) - 'a');
+
+	if (port < 4)
+	{
+		g_s_hostInput[port] = a_value;
+		g_hostReg[g_s_hostPorts[port][2]] = (g_hostReg[g_s_hostPorts[port][0]] & g_hostReg[g_s_hostPorts[port][1]]) |
+											(a_value & ~g_hostReg[g_s_hostPorts[port][1]]);
+	}
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : HOST_readPin
+[Description] :	This function is responsible for returning the level of a pin as seen on the wire
+
+[Args] :
+[in] uint8 a_port, uint8 a_pinNum:
+a_port: 'A', 'B', 'C' or 'D'
+a_pinNum: pin number [0-7]
+[Returns] : LOGIC_HIGH or LOGIC_LOW
+--------------------------------------------------------------------------------------------------------------- */
+uint8 HOST_readPin(uint8 a_port, uint8 a_pinNum)
+{
+	uint8 port = (uint8)((a_port | 0x20) - 'a');
+
+	if (port >= 4)
+	{
+		return LOGIC_LOW;
+	}
+	return (g_hostReg[g_s_hostPorts[port][2]] >> a_pinNum) & 1;
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : HOST_addObserver
+[Description] :	This function is responsible for adding a function called after each DIO access
+
+[Args] :
+[in] void (*a_observer_Ptr)(void):
+a_observer_Ptr: the function to be called
+[Returns] : 1 if it is added or 0 if HOST_MAX_OBSERVERS are already added
+--------------------------------------------------------------------------------------------------------------- */
+uint8 HOST_addObserver(void (*a_observer_Ptr)(void))
+{
+	if (g_s_hostObservers >= HOST_MAX_OBSERVERS)
+	{
+		return 0;
+	}
+	g_s_hostObserver[g_s_hostObservers++] = a_observer_Ptr;
+	return 1;
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : HOST_delayNs
+[Description] :	This function is responsible for advancing the simulated time
+
+[Args] :
+[in] HostTime a_ns:
+a_ns: the delay in nano seconds
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+void HOST_delayNs(HostTime a_ns)
+{
+	g_s_hostTime += a_ns;
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : HOST_delayCycles
+[Description] :	This function is responsible for advancing the simulated time by a number of CPU cycles at F_CPU
+
+[Args] :
+[in] uint32 a_cycles:
+a_cycles: the delay in CPU cycles
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+void HOST_delayCycles(uint32 a_cycles)
+{
+	g_s_hostTime += ((HostTime)a_cycles * 1000000000ULL) / F_CPU;
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : HOST_accessCount
+[Description] :	This function is responsible for returning the number of DIO accesses
+
+[Args] : This function takes no arguments
+[Returns] : The number of DIO accesses since the program started
+--------------------------------------------------------------------------------------------------------------- */
+uint32 HOST_accessCount(void)
+{
+	return g_s_hostAccesses;
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : HOST_timeNs
+[Description] :	This function is responsible for returning the simulated time
+
+[Args] : This function takes no arguments
+[Returns] : The simulated time in nano seconds since the program started
+--------------------------------------------------------------------------------------------------------------- */
+HostTime HOST_timeNs(void)
+{
+	return g_s_hostTime;
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : HOST_lcdAttach
+[Description] :	This function is responsible for wiring an emulated controller to the pins, it starts in its
+				power-on state: 8-bit interface, one line, increment entry mode, address 0 and a DDRAM of spaces
+
+[Args] :
+[in] uint8 a_ctrl, const HostLcdPins* a_pins_Ptr:
+a_ctrl: index of the emulated controller [0-HOST_LCD_MAX-1]
+a_pins_Ptr: its wiring
+[Returns] : 1 if it is wired or 0 if a_ctrl is out of range
+--------------------------------------------------------------------------------------------------------------- */
+uint8 HOST_lcdAttach(uint8 a_ctrl, const HostLcdPins* a_pins_Ptr)
+{
+	HostLcd* lcd_Ptr;
+	uint8 loop;
+
+	if (a_ctrl >= HOST_LCD_MAX)
+	{
+		return 0;
+	}
+	lcd_Ptr = &g_s_hostLcd[a_ctrl];
+	lcd_Ptr->s_pins		= *a_pins_Ptr;
+	lcd_Ptr->s_en		= HOST_readPin(a_pins_Ptr->s_en.s_port, a_pins_Ptr->s_en.s_pinNum);
+	lcd_Ptr->s_mode8	= 1;
+	lcd_Ptr->s_lines2	= 0;
+	lcd_Ptr->s_phase	= 0;
+	lcd_Ptr->s_entryMode	= 0x06;
+	lcd_Ptr->s_address	= 0;
+	lcd_Ptr->s_cgram	= 0;
+	for (loop=0;loop<HOST_LCD_DDRAM;loop++)
+	{
+		lcd_Ptr->s_ddram[loop] = ' ';
+	}
+	lcd_Ptr->s_attached	= 1;
+	return 1;
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : HOST_lcdDdram
+[Description] :	This function is responsible for returning one character of the DDRAM of an emulated controller
+
+[Args] :
+[in] uint8 a_ctrl, uint8 a_address:
+a_ctrl: index of the emulated controller
+a_address: DDRAM address [0-HOST_LCD_DDRAM-1]
+[Returns] : The character, or 0 if a_ctrl or a_address is out of range
+--------------------------------------------------------------------------------------------------------------- */
+uint8 HOST_lcdDdram(uint8 a_ctrl, uint8 a_address)
+{
+	if ((a_ctrl >= HOST_LCD_MAX) || (a_address >= HOST_LCD_DDRAM))
+	{
+		return 0;
+	}
+	return g_s_hostLcd[a_ctrl].s_ddram[a_address];
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : HOST_lcdAddress
+[Description] :	This function is responsible for returning the address counter of an emulated controller
+
+[Args] :
+[in] uint8 a_ctrl:
+a_ctrl: index of the emulated controller
+[Returns] : The DDRAM or CGRAM address, or 0 if a_ctrl is out of range
+--------------------------------------------------------------------------------------------------------------- */
+uint8 HOST_lcdAddress(uint8 a_ctrl)
+{
+	if (a_ctrl >= HOST_LCD_MAX)
+	{
+		return 0;
+	}
+	return g_s_hostLcd[a_ctrl].s_address;
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : HOST_lcdEntryMode
+[Description] :	This function is responsible for returning the entry mode of an emulated controller
+
+[Args] :
+[in] uint8 a_ctrl:
+a_ctrl: index of the emulated controller
+[Returns] : The last entry mode instruction (0x04 to 0x07), or 0 if a_ctrl is out of range
+--------------------------------------------------------------------------------------------------------------- */
+uint8 HOST_lcdEntryMode(uint8 a_ctrl)
+{
+	if (a_ctrl >= HOST_LCD_MAX)
+	{
+		return 0;
+	}
+	return g_s_hostLcd[a_ctrl].s_entryMode;
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : HOST_updatePins
+[Description] :	This function is responsible for updating the PIN registers from the PORT registers of the output
+				pins and the external levels of the input pins
+
+[Args] : This function takes no arguments
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+static void HOST_updatePins(void)
+{
+	uint8 loop;
+	uint8 ddr;
+
+	for (loop=0;loop<4;loop++)
+	{
+		ddr = g_hostReg[g_s_hostPorts[loop][1]];
+		g_hostReg[g_s_hostPorts[loop][2]] = (g_hostReg[g_s_hostPorts[loop][0]] & ddr) | (g_s_hostInput[loop] & ~ddr);
+	}
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : HOST_lcdSample
+[Description] :	This function is responsible for following the enable edges of the emulated controllers after a DIO
+				access, a byte is read or written on the falling edge and a read drives the data pins from the
+				rising edge
+
+[Args] : This function takes no arguments
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+static void HOST_lcdSample(void)
+{
+	HostLcd* lcd_Ptr;
+	uint8 ctrl;
+	uint8 loop;
+	uint8 level;
+	uint8 rs;
+	uint8 value;
+
+	for (ctrl=0;ctrl<HOST_LCD_MAX;ctrl++)
+	{
+		lcd_Ptr = &g_s_hostLcd[ctrl];
+		if (lcd_Ptr->s_attached == 0)
+		{
+			continue;
+		}
+		level = HOST_readPin(lcd_Ptr->s_pins.s_en.s_port, lcd_Ptr->s_pins.s_en.s_pinNum);
+		if (level == lcd_Ptr->s_en)
+		{
+			continue;
+		}
+		lcd_Ptr->s_en = level;
+		rs = HOST_readPin(lcd_Ptr->s_pins.s_rs.s_port, lcd_Ptr->s_pins.s_rs.s_pinNum);
+
+		if (HOST_readPin(lcd_Ptr->s_pins.s_rw.s_port, lcd_Ptr->s_pins.s_rw.s_pinNum) == LOGIC_HIGH)
+		{
+			/* read: the busy flag is never set, the address counter moves after a data read */
+			if (level == LOGIC_HIGH)
+			{
+				value = (rs == LOGIC_HIGH) ? (lcd_Ptr->s_cgram ? 0 : lcd_Ptr->s_ddram[lcd_Ptr->s_address]) :
+											 lcd_Ptr->s_address;
+				if (lcd_Ptr->s_pins.s_width == 4)
+				{
+					value = (lcd_Ptr->s_mode8 || (lcd_Ptr->s_phase == 0)) ? (value >> 4) : (value & 0x0F);
+				}
+				HOST_lcdDrive(lcd_Ptr, value);
+			}
+			else
+			{
+				if ((lcd_Ptr->s_pins.s_width == 4) && (lcd_Ptr->s_mode8 == 0))
+				{
+					lcd_Ptr->s_phase ^= 1;
+				}
+				if ((lcd_Ptr->s_phase == 0) && (rs == LOGIC_HIGH))
+				{
+					HOST_lcdMove(lcd_Ptr, (lcd_Ptr->s_entryMode >> 1) & 1);
+				}
+			}
+			continue;
+		}
+		if (level == LOGIC_HIGH)
+		{
+			continue;
+		}
+
+		/* write, latched on the falling edge */
+		value = 0;
+		for (loop=0;loop<lcd_Ptr->s_pins.s_width;loop++)
+		{
+			value |= HOST_readPin(lcd_Ptr->s_pins.s_data[loop].s_port, lcd_Ptr->s_pins.s_data[loop].s_pinNum) << loop;
+		}
+		if (lcd_Ptr->s_pins.s_width == 4)
+		{
+			if (lcd_Ptr->s_mode8)
+			{
+				/* only D4-D7 are wired, the low nibble of the 8-bit instruction reads 0 */
+				value <<= 4;
+			}
+			else if (lcd_Ptr->s_phase == 0)
+			{
+				lcd_Ptr->s_high = value;
+				lcd_Ptr->s_phase = 1;
+				continue;
+			}
+			else
+			{
+				value |= lcd_Ptr->s_high << 4;
+				lcd_Ptr->s_phase = 0;
+			}
+		}
+		HOST_lcdExecute(lcd_Ptr, rs, value);
+	}
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : HOST_lcdExecute
+[Description] :	This function is responsible for executing one instruction or data write of an emulated controller
+
+[Args] :
+[in] HostLcd* a_lcd_Ptr, uint8 a_rs, uint8 a_value:
+a_lcd_Ptr: the emulated controller
+a_rs: LOGIC_HIGH for a data write, LOGIC_LOW for an instruction
+a_value: the byte written
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+static void HOST_lcdExecute(HostLcd* a_lcd_Ptr, uint8 a_rs, uint8 a_value)
+{
+	uint8 loop;
+
+	if (a_rs == LOGIC_HIGH)
+	{
+		if ((a_lcd_Ptr->s_cgram == 0) && (a_lcd_Ptr->s_address < HOST_LCD_DDRAM))
+		{
+			a_lcd_Ptr->s_ddram[a_lcd_Ptr->s_address] = a_value;
+		}
+		HOST_lcdMove(a_lcd_Ptr, (a_lcd_Ptr->s_entryMode >> 1) & 1);
+	}
+	else if (a_value & 0x80)
+	{
+		/* set DDRAM address */
+		a_lcd_Ptr->s_address = a_value & 0x7F;
+		a_lcd_Ptr->s_cgram = 0;
+	}
+	else if (a_value & 0x40)
+	{
+		/* set CGRAM address */
+		a_lcd_Ptr->s_address = a_value & 0x3F;
+		a_lcd_Ptr->s_cgram = 1;
+	}
+	else if (a_value & 0x20)
+	{
+		/* function set */
+		a_lcd_Ptr->s_mode8 = (a_value >> 4) & 1;
+		a_lcd_Ptr->s_lines2 = (a_value >> 3) & 1;
+		a_lcd_Ptr->s_phase = 0;
+	}
+	else if (a_value & 0x10)
+	{
+		/* cursor or display shift, only the cursor moves */
+		if ((a_value & 0x08) == 0)
+		{
+			HOST_lcdMove(a_lcd_Ptr, (a_value >> 2) & 1);
+		}
+	}
+	else if (a_value & 0x04)
+	{
+		a_lcd_Ptr->s_entryMode = a_value & 0x07;
+	}
+	else if (a_value & 0x02)
+	{
+		/* return home */
+		a_lcd_Ptr->s_address = 0;
+		a_lcd_Ptr->s_cgram = 0;
+	}
+	else if (a_value & 0x01)
+	{
+		/* clear display, it also sets the increment entry mode */
+		for (loop=0;loop<HOST_LCD_DDRAM;loop++)
+		{
+			a_lcd_Ptr->s_ddram[loop] = ' ';
+		}
+		a_lcd_Ptr->s_address = 0;
+		a_lcd_Ptr->s_cgram = 0;
+		a_lcd_Ptr->s_entryMode |= 0x02;
+	}
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : HOST_lcdMove
+[Description] :	This function is responsible for moving the address counter of an emulated controller by one place,
+				from the end of a line it goes where the number of lines of the function set leads
+
+[Args] :
+[in] HostLcd* a_lcd_Ptr, uint8 a_increment:
+a_lcd_Ptr: the emulated controller
+a_increment: 1 to move to the next address, 0 to the previous one
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+static void HOST_lcdMove(HostLcd* a_lcd_Ptr, uint8 a_increment)
+{
+	uint8 address = a_lcd_Ptr->s_address;
+
+	if (a_lcd_Ptr->s_cgram)
+	{
+		a_lcd_Ptr->s_address = (a_increment ? (address + 1) : (address - 1)) & 0x3F;
+	}
+	else if (a_lcd_Ptr->s_lines2)
+	{
+		/* two lines of 40 characters at 0x00 and 0x40 */
+		if (a_increment)
+		{
+			a_lcd_Ptr->s_address = (address == 0x27) ? 0x40 : ((address == 0x67) ? 0x00 : (address + 1));
+		}
+		else
+		{
+			a_lcd_Ptr->s_address = (address == 0x40) ? 0x27 : ((address == 0x00) ? 0x67 : (address - 1));
+		}
+	}
+	else if (a_increment)
+	{
+		a_lcd_Ptr->s_address = (address >= 0x4F) ? 0x00 : (address + 1);
+	}
+	else
+	{
+		a_lcd_Ptr->s_address = (address == 0x00) ? 0x4F : (address - 1);
+	}
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : HOST_lcdDrive
+[Description] :	This function is responsible for driving the data pins of an emulated controller with the byte or
+				nibble of a read
+
+[Args] :
+[in] HostLcd* a_lcd_Ptr, uint8 a_value:
+a_lcd_Ptr: the emulated controller
+a_value: the nibble or byte, bit 0 is driven on s_data[0]
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+static void HOST_lcdDrive(HostLcd* a_lcd_Ptr, uint8 a_value)
+{
+	const HostPin* pin_Ptr;
+	uint8 port;
+	uint8 loop;
+
+	for (loop=0;loop<a_lcd_Ptr->s_pins.s_width;loop++)
+	{
+		pin_Ptr = &a_lcd_Ptr->s_pins.s_data[loop];
+		port = (uint8)((pin_Ptr->s_port | 0x20) - 'a');
+		if (port >= 4)
+		{
+			continue;
+		}
+		if ((a_value >> loop) & 1)
+		{
+			g_s_hostInput[port] |= (1 << pin_Ptr->s_pinNum);
+		}
+		else
+		{
+			g_s_hostInput[port] &= ~(1 << pin_Ptr->s_pinNum);
+		}
+	}
+	HOST_updatePins();
+}
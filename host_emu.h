@@ -0,0 +1,242 @@
+/* --------------------------------------------------------------------------------------------------
+[FILE NAME]:		<host_emu.h>
+[AUTHOR(S)]:		<Ayman Younis>
+[DATE CREATED]:		<18/10/2026>
+[DESCRIPTION]:		This file contains the host emulation header file, it replaces the memory mapped registers and
+*					the avr-libc delays when the drivers are built for the PC with HOST_EMULATION defined:
+*
+*					gcc -DHOST_EMULATION lcd_test_app.c lcd.c dio.c host_emu.c
+*
+*					The registers are a RAM array, the delays and each DIO access advance a simulated time in nano
+*					seconds instead of waiting, and observers (the waveform tracer of lcd_trace.h for example)
+*					are called after each DIO access to see the new pin levels at the simulated time.
+*
+*					An emulated HD44780 controller can be wired to the pins with HOST_lcdAttach: it decodes the
+*					bytes strobed on its enable pin (8-bit or 4-bit interface, function set, clear, return home,
+*					entry mode, cursor shift, DDRAM and CGRAM address, data write) into its DDRAM, address counter
+*					and entry mode, and drives the data pins for the reads of the busy flag (never busy) and the
+*					address counter or the DDRAM. The display shift and the CGRAM content are not emulated.
+-------------------------------------------------------------------------------------------------- */
+
+/*	HOST_EMU_H_MAIN will be defined at the host emulation source file only, so the EXTERN will be removed, also
+*   EXTERN becomes extern in other files that include host_emu.h. It is included in the middle of other headers
+*   (dio.h through peripheral_reg.h), their EXTERN is kept aside and given back at the end of this file
+*/
+#pragma push_macro("EXTERN")
+#ifdef EXTERN
+#undef EXTERN
+#endif
+#ifdef HOST_EMU_H_MAIN
+#define EXTERN
+#else
+#define EXTERN extern
+#endif
+
+#ifndef HOST_EMU_H_
+#define HOST_EMU_H_
+
+/*--------------------------------------------- INCLUDES -------------------------------------------*/
+#include "std_type.h"
+
+/*---------------------------------- Definitions and configurations --------------------------------*/
+/*	size of the emulated I/O memory, it holds all the register addresses of peripheral_reg.h */
+#define HOST_REGISTERS			0x60
+
+/*	CPU cycles taken by one DIO function call, they are added to the simulated time of each access */
+#ifndef HOST_GPIO_CYCLES
+#define HOST_GPIO_CYCLES		20
+#endif
+
+/*	maximum number of functions called after each DIO access */
+#define HOST_MAX_OBSERVERS		4
+
+/*	emulated register at an I/O memory address */
+#define HOST_REG(a_address)		(g_hostReg[(a_address)])
+
+/*	emulated controllers, and the size of the DDRAM of each one */
+#define HOST_LCD_MAX			2
+#define HOST_LCD_DDRAM			0x80
+
+/*	avr-libc delays, they only advance the simulated time */
+#define _delay_us(a_us)			HOST_delayNs((HostTime)((a_us) * 1000.0))
+#define _delay_ms(a_ms)			HOST_delayNs((HostTime)((a_ms) * 1000000.0))
+#define _delay_loop_2(a_count)	HOST_delayCycles((((a_count) == 0) ? 65536UL : (a_count)) * 4UL)
+
+/*----------------------------------------------- Types ----------------------------------------------*/
+/*	simulated time in nano seconds */
+typedef unsigned long long HostTime;
+
+/* ---------------------------------------------------------------------------------------------------
+[Structure Name]: HostPin
+[Structure Description]: This structure is one pin wired to an emulated controller:
+								1. s_port: 'A', 'B', 'C' or 'D'
+								2. s_pinNum: pin number [0-7]
+---------------------------------------------------------------------------------------------------- */
+typedef struct
+{
+	uint8 s_port;
+	uint8 s_pinNum;
+}HostPin;
+
+/* ---------------------------------------------------------------------------------------------------
+[Structure Name]: HostLcdPins
+[Structure Description]: This structure is the wiring of one emulated controller:
+								1. s_rs, s_rw, s_en: the control lines
+								2. s_data: the data lines, D0 to D7 in 8-bit mode or D4 to D7 in 4-bit mode
+								3. s_width: 8 or 4 data lines
+---------------------------------------------------------------------------------------------------- */
+typedef struct
+{
+	HostPin s_rs;
+	HostPin s_rw;
+	HostPin s_en;
+	HostPin s_data[8];
+	uint8 s_width;
+}HostLcdPins;
+
+/*------------------------------------------ Global Variables ------------------------------------------*/
+/* ---------------------------------------------------------------------------------------------------
+[Variable Name]: g_hostReg
+[Variable Description]: The emulated I/O memory, indexed by the register addresses of peripheral_reg.h
+---------------------------------------------------------------------------------------------------- */
+extern volatile uint8 g_hostReg[HOST_REGISTERS];
+
+/*----------------------------------- FUNCTION DECLARATIONS ----------------------------------------------------*/
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : HOST_gpioAccess
+[Description] :	This function is responsible for ending one DIO access, it advances the simulated time by
+				HOST_GPIO_CYCLES, updates the PIN registers from the PORT registers of the output pins and the
+				external levels of the input pins, then calls the observers
+
+[Args] : This function takes no arguments
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+EXTERN void HOST_gpioAccess(void);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : HOST_setInput
+[Description] :	This function is responsible for setting the levels driven by the outside world on a port, they are
+				read in the PIN register for the pins configured as input
+
+[Args] :
+[in] uint8 a_port, uint8 a_value:
+a_port: 'A', 'B', 'C' or 'D'
+a_value: level of each pin of the port
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+EXTERN void HOST_setInput(uint8 a_port, uint8 a_value);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : HOST_readPin
+[Description] :	This function is responsible for returning the level of a pin as seen on the wire
+
+[Args] :
+[in] uint8 a_port, uint8 a_pinNum:
+a_port: 'A', 'B', 'C' or 'D'
+a_pinNum: pin number [0-7]
+[Returns] : LOGIC_HIGH or LOGIC_LOW
+--------------------------------------------------------------------------------------------------------------- */
+EXTERN uint8 HOST_readPin(uint8 a_port, uint8 a_pinNum);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : HOST_addObserver
+[Description] :	This function is responsible for adding a function called after each DIO access
+
+[Args] :
+[in] void (*a_observer_Ptr)(void):
+a_observer_Ptr: the function to be called
+[Returns] : 1 if it is added or 0 if HOST_MAX_OBSERVERS are already added
+--------------------------------------------------------------------------------------------------------------- */
+EXTERN uint8 HOST_addObserver(void (*a_observer_Ptr)(void));
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : HOST_delayNs
+[Description] :	This function is responsible for advancing the simulated time
+
+[Args] :
+[in] HostTime a_ns:
+a_ns: the delay in nano seconds
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+EXTERN void HOST_delayNs(HostTime a_ns);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : HOST_delayCycles
+[Description] :	This function is responsible for advancing the simulated time by a number of CPU cycles at F_CPU
+
+[Args] :
+[in] uint32 a_cycles:
+a_cycles: the delay in CPU cycles
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+EXTERN void HOST_delayCycles(uint32 a_cycles);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : HOST_accessCount
+[Description] :	This function is responsible for returning the number of DIO accesses, each one costs
+				HOST_GPIO_CYCLES of CPU time
+
+[Args] : This function takes no arguments
+[Returns] : The number of DIO accesses since the program started
+--------------------------------------------------------------------------------------------------------------- */
+EXTERN uint32 HOST_accessCount(void);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : HOST_lcdAttach
+[Description] :	This function is responsible for wiring an emulated controller to the pins, it starts in its
+				power-on state: 8-bit interface, one line, increment entry mode, address 0 and a DDRAM of spaces
+
+[Args] :
+[in] uint8 a_ctrl, const HostLcdPins* a_pins_Ptr:
+a_ctrl: index of the emulated controller [0-HOST_LCD_MAX-1]
+a_pins_Ptr: its wiring
+[Returns] : 1 if it is wired or 0 if a_ctrl is out of range
+--------------------------------------------------------------------------------------------------------------- */
+EXTERN uint8 HOST_lcdAttach(uint8 a_ctrl, const HostLcdPins* a_pins_Ptr);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : HOST_lcdDdram
+[Description] :	This function is responsible for returning one character of the DDRAM of an emulated controller
+
+[Args] :
+[in] uint8 a_ctrl, uint8 a_address:
+a_ctrl: index of the emulated controller
+a_address: DDRAM address [0-HOST_LCD_DDRAM-1]
+[Returns] : The character, or 0 if a_ctrl or a_address is out of range
+--------------------------------------------------------------------------------------------------------------- */
+EXTERN uint8 HOST_lcdDdram(uint8 a_ctrl, uint8 a_address);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : HOST_lcdAddress
+[Description] :	This function is responsible for returning the address counter of an emulated controller
+
+[Args] :
+[in] uint8 a_ctrl:
+a_ctrl: index of the emulated controller
+[Returns] : The DDRAM or CGRAM address, or 0 if a_ctrl is out of range
+--------------------------------------------------------------------------------------------------------------- */
+EXTERN uint8 HOST_lcdAddress(uint8 a_ctrl);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : HOST_lcdEntryMode
+[Description] :	This function is responsible for returning the entry mode of an emulated controller
+
+[Args] :
+[in] uint8 a_ctrl:
+a_ctrl: index of the emulated controller
+[Returns] : The last entry mode instruction (0x04 to 0x07), or 0 if a_ctrl is out of range
+--------------------------------------------------------------------------------------------------------------- */
+EXTERN uint8 HOST_lcdEntryMode(uint8 a_ctrl);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : HOST_timeNs
+[Description] :	This function is responsible for returning the simulated time
+
+[Args] : This function takes no arguments
+[Returns] : The simulated time in nano seconds since the program started
+--------------------------------------------------------------------------------------------------------------- */
+EXTERN HostTime HOST_timeNs(void);
+
+#endif /* HOST_EMU_H_ */
+
+#pragma pop_macro("EXTERN")
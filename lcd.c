@@ -22,427 +22,3471 @@
 /*--------------------------------------------- INCLUDES ------------------------------------------*/
 #define LCD_H_MAIN
 #include "lcd.h"
+#include "flash_mem.h"
+
+/*	LCD_PROFILE times the main functions with Timer0, see lcd_prof.h */
+#ifdef LCD_PROFILE
+#include "lcd_prof.h"
+#else
+#define LCD_PROF_BEGIN()
+#define LCD_PROF_END(a_id)
+#endif
+
+/*	LCD_SLEEP_WAITS sleeps in the long waits with the Timer0 compare match, see timer.h */
+#ifdef LCD_SLEEP_WAITS
+#include "timer.h"
+#define LCD_SLEPT(a_us)		(((a_us) >= LCD_SLEEP_MIN_US) && TIMER0_sleepUs(a_us))
+#else
+#define LCD_SLEPT(a_us)		0
+#endif
 
 /* ---------------------------------------------------------------------------------------------------
-[Structure Name]: g_s_dataConfig
-[Structure Description]: LCD Data Configurations Structure is responsible for describe Data bins,
-						 Array of structure can be 8 or 4 structures depending on LCD_IO_MODE :
+[Structure Name]: g_lcd
+[Structure Description]: The default display, its pin map and geometry are filled at compile time from the 
+						 definitions in lcd.h, so the singleton functions don't need to fill any structure at
+						 run time:
 [structure members]:								
-							1. PORT Which the line is connect with: 'A 'B' 'C' or 'D'
-							2. Pin number in the PORT: [0-7]
-							3. Direction of pin: Button is setted as INPUT
-							4. Value state of the pin
+							1. Data pins, 8 or 4 pins depending on LCD_IO_MODE
+							2. RS, RW control pins and the EN pin of each controller
+							3. number of lines and characters per line
+							4. DDRAM address and controller of each line
+							5. display control command, set by LCD_init
+---------------------------------------------------------------------------------------------------- */
+Lcd g_lcd =
+{
+	.s_data =
+	{
+	/* Configure data pins from 0 to 3 only if 8-bit mode defined */
+	#if (LCD_IO_MODE == 8)
+		LCD_PIN_INIT(LCD_DATA0_PORT, LCD_DATA0_PIN),
+		LCD_PIN_INIT(LCD_DATA1_PORT, LCD_DATA1_PIN),
+		LCD_PIN_INIT(LCD_DATA2_PORT, LCD_DATA2_PIN),
+		LCD_PIN_INIT(LCD_DATA3_PORT, LCD_DATA3_PIN),
+	#endif
+	/* Configure data pins from 4 to 7 whether its defined as 8-bit mode or 4-bit mode */
+		LCD_PIN_INIT(LCD_DATA4_PORT, LCD_DATA4_PIN),
+		LCD_PIN_INIT(LCD_DATA5_PORT, LCD_DATA5_PIN),
+		LCD_PIN_INIT(LCD_DATA6_PORT, LCD_DATA6_PIN),
+		LCD_PIN_INIT(LCD_DATA7_PORT, LCD_DATA7_PIN)
+	},
+	.s_rs = LCD_PIN_INIT(LCD_RS_PORT, LCD_RS_PIN),
+	.s_rw = LCD_PIN_INIT(LCD_RW_PORT, LCD_RW_PIN),
+#ifdef LCD_EN2_PORT
+	/* 40x4 module, lines 3 and 4 are driven by the second controller */
+	.s_ctrl = {{.s_en = LCD_PIN_INIT(LCD_EN_PORT, LCD_EN_PIN)}, {.s_en = LCD_PIN_INIT(LCD_EN2_PORT, LCD_EN2_PIN)}},
+	.s_controllers = 2,
+	.s_lineCtrl = {0, 0, 1, 1},
+#else
+	.s_ctrl = {{.s_en = LCD_PIN_INIT(LCD_EN_PORT, LCD_EN_PIN)}},
+	.s_controllers = 1,
+#endif
+	.s_lines = LCD_LINES,
+	.s_length = LCD_DISP_LENGTH,
+	.s_lineStart = {LCD_START_LINE1, LCD_START_LINE2, LCD_START_LINE3, LCD_START_LINE4},
+	.s_dispCtrl = LCD_CURSOR_OFF
+};
+
+/* ---------------------------------------------------------------------------------------------------
+[Variable Name]: g_s_lcdList
+[Variable Description]: The list of the initialized displays linked by s_next, the scheduler goes through it to
+						find the controller which has queued writes and the nearest busy deadline
 ---------------------------------------------------------------------------------------------------- */
-static DioConfig g_s_dataConfig[LCD_IO_MODE];
+static Lcd* g_s_lcdList;
+
+/*	powers of ten of the decimal conversion, the last digit is what remains after 10 */
+static const uint32 g_s_powersOfTen[9] FLASH_CONST =
+{
+	1000000000UL, 100000000UL, 10000000UL, 1000000UL, 100000UL, 10000UL, 1000UL, 100UL, 10UL
+};
 
 /* ---------------------------------------------------------------------------------------------------
-[Structure Name]: g_s_ctrlConfig
-[Structure Description]: LCD Control Configurations Structure is responsible for describe RS, RW, EN bins,
-						 Array of 3 structure :
-[structure members]:								
-							1. PORT Which the line is connect with: 'A 'B' 'C' or 'D'
-							2. Pin number in the PORT: [0-7]
-							3. Direction of pin: Button is setted as INPUT
-							4. Value state of the pin
+[Variable Name]: g_s_busClock
+[Variable Description]: The bus time in micro seconds, it is advanced only by the delays done by the driver and 
+						never counts the time spent by the application between the LCD calls, so it is always 
+						behind the real time and a deadline reached by it is reached for sure by the controller
+---------------------------------------------------------------------------------------------------- */
+static uint16 g_s_busClock;
+
+/* ---------------------------------------------------------------------------------------------------
+[Variable Name]: g_s_batch
+[Variable Description]: Nesting level of LCD_beginBatch, while it is not zero the writes are only queued
+---------------------------------------------------------------------------------------------------- */
+static uint8 g_s_batch;
+
+/* ---------------------------------------------------------------------------------------------------
+[Variable Name]: g_s_preemptHook, g_s_inHook
+[Variable Description]: The function called by the scheduler before each write to queue urgent writes, and a flag
+						set while it runs so it is not called again from its own writes
 ---------------------------------------------------------------------------------------------------- */
-static DioConfig g_s_ctrlConfig[3];
+static void (*g_s_preemptHook)(void);
+static uint8 g_s_inHook;
+
+/* ---------------------------------------------------------------------------------------------------
+[Variable Name]: g_s_powered
+[Variable Description]: Set after the power-on wait of the first LCD_init, the displays initialized after it share
+						the same supply and don't wait again
+---------------------------------------------------------------------------------------------------- */
+static uint8 g_s_powered;
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_pinConfig
+[Description] :	This function is responsible for filling one pin structure with its port and pin number and the 
+				initial values, OUTPUT direction and LOGIC_LOW
+					
+[Args] :
+[in] DioConfig* a_pin_Ptr, uint8 a_lcdPort, uint8 a_lcdPin:
+a_pin_Ptr: pointer to the pin structure to be filled
+a_lcdPort: PORT Which the line is connect with: 'A 'B' 'C' or 'D'
+a_lcdPin: Pin number in the PORT: [0-7]
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+static void LCD_pinConfig(DioConfig* a_pin_Ptr, uint8 a_lcdPort, uint8 a_lcdPin)
+{
+	a_pin_Ptr->s_port		= a_lcdPort;
+	a_pin_Ptr->s_pinNum		= a_lcdPin;
+	a_pin_Ptr->s_direction	= OUTPUT;
+	a_pin_Ptr->s_value		= LOGIC_LOW;
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_configurations
+[Description] : This function is responsible for setting the direction of the LCD data and control pins of a display
+				as OUTPUT, the pin structures are already filled at compile time or by the LCD_setxxx functions
+					
+[Args] :
+[in] Lcd* a_lcd_Ptr:
+a_lcd_Ptr: pointer to the display handle
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+static void LCD_configurations(Lcd* a_lcd_Ptr)
+{	
+	uint8 loop;
+	
+	/* set direction of the data pins, 8 or 4 pins depending on LCD_IO_MODE */
+	for (loop=0;loop<LCD_IO_MODE;loop++)
+	{
+		DIO_setPinDirection(& a_lcd_Ptr->s_data[loop]);
+	}
+	
+	/* set direction of RS, RW LCD control pins and the EN pin of each controller */
+	DIO_setPinDirection(& a_lcd_Ptr->s_rs);
+	DIO_setPinDirection(& a_lcd_Ptr->s_rw);
+	for (loop=0;loop<a_lcd_Ptr->s_controllers;loop++)
+	{
+		DIO_setPinDirection(& a_lcd_Ptr->s_ctrl[loop].s_en);
+	}
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : itoaAnsiC
+[Description] : This function is responsible for converting from integer to string to display number on LCD,
+				Ansi C "itoa" based on Kernighan & Ritchie's "Ansi C"
+				
+[Args]: sint32 a_value, uint8* a_str_Ptr, uint8 a_base
+a_value: the integer value to be converted
+a_str_Ptr: pointer to array of character which will hold the string value represent the integer number
+a_base: the value base number, binary, decimal, octal, hexadecimal, ..
+[in] void:
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+static void itoaAnsiC(sint32 a_value, uint8* a_str_Ptr, uint8 a_base);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_decimal
+[Description] : This function is responsible for converting an unsigned integer to its decimal digits by subtracting
+				the powers of ten, at most 9 subtractions per digit instead of a 32-bit division, the digits come
+				in their order so the string is not reversed
+				
+[Args] :
+[in] uint32 a_value, uint8* a_str_Ptr:
+a_value: the integer value to be converted
+a_str_Ptr: pointer to at least 11 characters which will hold the digits and the terminator
+[Returns] : The number of digits
+--------------------------------------------------------------------------------------------------------------- */
+static uint8 LCD_decimal(uint32 a_value, uint8* a_str_Ptr);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : strreverse
+[Description] : This function is responsible for reversing string
+				
+[Args]: uint8* a_begin_Ptr, uint8* a_end_Ptr
+a_begin_Ptr: pointer to the start character
+a_end_Ptr: pointer to the end character
+[in] void:
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+static void strreverse(uint8* a_begin_Ptr, uint8* a_end_Ptr);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_write
+[Description] : This function is responsible for write on LCD, it queues the data or command to the controller which
+				should receive it, data characters and cursor location go to the active controller and the other
+				commands go to all the controllers of the display, then it sends the queued writes if no batch is
+				started
+				
+[Args] :
+[in] Lcd* a_lcd_Ptr, uint8 a_data, uint8 a_dataType:
+a_lcd_Ptr: pointer to the display handle
+a_data: The data to be sent to LCD
+a_dataType: the data type whether its a command or data
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+static void LCD_write(Lcd* a_lcd_Ptr, uint8 a_data, uint8 a_dataType);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_enqueue
+[Description] : This function is responsible for adding one write to the queue of a controller, if the queue is full
+				the scheduler sends writes till there is a free place
+				
+[Args] :
+[in] Lcd* a_lcd_Ptr, uint8 a_ctrl, uint8 a_data, uint8 a_dataType:
+a_lcd_Ptr: pointer to the display handle
+a_ctrl: index of the controller
+a_data: The data to be sent to LCD
+a_dataType: LCD_XFER_CMD or LCD_XFER_DATA
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+static void LCD_enqueue(Lcd* a_lcd_Ptr, uint8 a_ctrl, uint8 a_data, uint8 a_dataType);
+
+#if (LCD_PEEPHOLE == 1)
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_peephole
+[Description] : This function is responsible for optimizing a write before it is queued, it is merged with the last
+				queued write of the lane, or dropped, when the controller ends in the same state without it
+				
+[Args] :
+[in] Lcd* a_lcd_Ptr, uint8 a_ctrl:
+a_lcd_Ptr: pointer to the display handle
+a_ctrl: index of the controller
+[in/out] uint8* a_data_Ptr, uint8* a_dataType_Ptr:
+a_data_Ptr, a_dataType_Ptr: the write, a space on a blank cell is changed to a cursor location command
+[Returns] : This function return 1 if nothing has to be queued or 0 if the write has to be queued
+--------------------------------------------------------------------------------------------------------------- */
+static uint8 LCD_peephole(Lcd* a_lcd_Ptr, uint8 a_ctrl, uint8* a_data_Ptr, uint8* a_dataType_Ptr);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_peepKind
+[Description] : This function is responsible for returning the kind of a command for the peephole optimizer, the
+				commands of these kinds only set a state which the next command of the same kind replaces
+				
+[Args] :
+[in] uint8 a_command:
+a_command: the command
+[Returns] : SET_CURSOR_LOCATION, LCD_DISP_OFF (display control), LCD_ENTRY_DEC (entry mode) or 0 for the others
+--------------------------------------------------------------------------------------------------------------- */
+static uint8 LCD_peepKind(uint8 a_command);
+#endif
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_scheduleStep
+[Description] : This function is responsible for sending one queued write, it goes through the controllers of all
+				displays and picks the one which has queued writes and the nearest busy deadline, waits for this
+				deadline if it is not reached yet, sends the oldest write and calculates the new deadline
+				
+[Args] :
+[in] void:
+[Returns] : This function return 1 if a write is sent or 0 if all the queues are empty
+--------------------------------------------------------------------------------------------------------------- */
+static uint8 LCD_scheduleStep(void);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_schedulePick
+[Description] : This function is responsible for finding the controller which the scheduler sends to next, it has
+				urgent queued writes, or background ones if no controller has urgent writes, and the nearest busy
+				deadline
+				
+[Args] :
+[out] Lcd** a_lcd_PPtr, uint8* a_ctrl_Ptr, uint8* a_lane_Ptr, sint16* a_wait_Ptr:
+a_lcd_PPtr: the display of the picked controller
+a_ctrl_Ptr: index of the picked controller
+a_lane_Ptr: lane of the write to be sent
+a_wait_Ptr: time in micro seconds till the controller is not busy
+[Returns] : This function return 1 if a controller is picked or 0 if all the queues are empty
+--------------------------------------------------------------------------------------------------------------- */
+static uint8 LCD_schedulePick(Lcd** a_lcd_PPtr, uint8* a_ctrl_Ptr, uint8* a_lane_Ptr, sint16* a_wait_Ptr);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_busWrite
+[Description] : This function is responsible for write on one controller of the LCD, it configure rs as low or high 
+				depending on Data Type whether its command or data, then send data to lcd data pins based on 
+				LCD_IO_MODE, and toggle the enable pin of this controller
+				
+[Args] :
+[in] Lcd* a_lcd_Ptr, uint8 a_ctrl, uint8 a_data, uint8 a_dataType:
+a_lcd_Ptr: pointer to the display handle
+a_ctrl: index of the controller
+a_data: The data to be sent to LCD
+a_dataType: the data type whether its a command or data
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+static void LCD_busWrite(Lcd* a_lcd_Ptr, uint8 a_ctrl, uint8 a_data, uint8 a_dataType);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_goToAddress
+[Description] : This function is responsible for queuing the cursor location command of a row and column, and 
+				making the controller of this line the active one of the current lane
+				
+[Args] :
+[in] Lcd* a_lcd_Ptr, uint8 a_row,uint8 a_col:
+a_lcd_Ptr: pointer to the display handle
+a_row: the row number, it must be less than the number of lines
+a_col: the column number
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+static void LCD_goToAddress(Lcd* a_lcd_Ptr, uint8 a_row, uint8 a_col);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_frameFill
+[Description] : This function is responsible for filling the front and/or back buffer of a frame with spaces
+				
+[Args] :
+[in] LcdFrame* a_frame_Ptr, uint8 a_front:
+a_frame_Ptr: pointer to the frame buffer
+a_front: 1 to fill the front buffer too, 0 to fill the back buffer only
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+static void LCD_frameFill(LcdFrame* a_frame_Ptr, uint8 a_front);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_frameStep
+[Description] : This function is responsible for queuing the first changed cell of a frame, with the cursor location
+				command before it if the controller cursor is not on this cell already
+				
+[Args] :
+[in] Lcd* a_lcd_Ptr:
+a_lcd_Ptr: pointer to the display handle, it must have a frame
+[Returns] : This function return 1 if a cell is queued or 0 if the frame has no changed cell or is held
+--------------------------------------------------------------------------------------------------------------- */
+static uint8 LCD_frameStep(Lcd* a_lcd_Ptr);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_workLeft
+[Description] : This function is responsible for counting the queued writes and the changed frame cells of all the
+				displays
+				
+[Args] :
+[in] void:
+[Returns] : The number of queued writes and changed cells
+--------------------------------------------------------------------------------------------------------------- */
+static uint16 LCD_workLeft(void);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_frameGap
+[Description] : This function is responsible for counting the cells between the cursor of a controller and a cell
+				of the frame, when they are in the same DDRAM block
+				
+[Args] :
+[in] Lcd* a_lcd_Ptr, uint8 a_row, uint8 a_col:
+a_lcd_Ptr: pointer to the display handle, it must have a frame
+a_row, a_col: the cell
+[Returns] : The number of cells the cursor passes before reaching the cell, or LCD_ADDRESS_UNKNOWN if it can't
+--------------------------------------------------------------------------------------------------------------- */
+static uint8 LCD_frameGap(Lcd* a_lcd_Ptr, uint8 a_row, uint8 a_col);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_frameCursorLost
+[Description] : This function is responsible for forgetting the cursor cells of all controllers of a frame
+				
+[Args] :
+[in] LcdFrame* a_frame_Ptr:
+a_frame_Ptr: pointer to the frame buffer
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+static void LCD_frameCursorLost(LcdFrame* a_frame_Ptr);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_crcCharacter
+[Description] : This function is responsible for drawing one character of a render, it is hashed by the first pass
+				and sent by the second one if its span changed
+				
+[Args] :
+[in] Lcd* a_lcd_Ptr, uint8 a_dataCharacter:
+a_lcd_Ptr: pointer to the display handle, it must be inside a render
+a_dataCharacter: The character to be displayed
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+static void LCD_crcCharacter(Lcd* a_lcd_Ptr, uint8 a_dataCharacter);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_entrySync
+[Description] : This function is responsible for queuing the entry mode of a text direction if the last queued
+				entry mode of the display is not this one, the display shift bit is kept
+				
+[Args] :
+[in] Lcd* a_lcd_Ptr, uint8 a_direction:
+a_lcd_Ptr: pointer to the display handle
+a_direction: LCD_DIRECTION_LTR or LCD_DIRECTION_RTL
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+static void LCD_entrySync(Lcd* a_lcd_Ptr, uint8 a_direction);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_crc8
+[Description] : This function is responsible for adding one byte to a CRC-8, polynomial x^8 + x^2 + x + 1
+				
+[Args] :
+[in] uint8 a_crc, uint8 a_data:
+a_crc: the CRC of the previous bytes
+a_data: the byte to be added
+[Returns] : The new CRC
+--------------------------------------------------------------------------------------------------------------- */
+static uint8 LCD_crc8(uint8 a_crc, uint8 a_data);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_transfer
+[Description] : This function is responsible for sending one write to a controller when it is not busy anymore, then
+				calculating its new busy deadline and following its address counter and entry mode
+				
+[Args] :
+[in] Lcd* a_lcd_Ptr, uint8 a_ctrl, uint8 a_data, uint8 a_dataType:
+a_lcd_Ptr: pointer to the display handle
+a_ctrl: index of the controller
+a_data: The data to be sent to LCD
+a_dataType: LCD_XFER_CMD or LCD_XFER_DATA
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+static void LCD_transfer(Lcd* a_lcd_Ptr, uint8 a_ctrl, uint8 a_data, uint8 a_dataType);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_follow
+[Description] : This function is responsible for updating the state of a controller after a write, the address is
+				LCD_ADDRESS_UNKNOWN after writing the CGRAM address or shifting the cursor, and the DDRAM is not
+				known blank anymore after a data byte written where the address is not known or a display shift
+				
+[Args] :
+[in] LcdMode* a_mode_Ptr, uint8 a_data, uint8 a_dataType:
+a_mode_Ptr: pointer to the state of the controller, or the state after its queued writes
+a_data: The data or command written
+a_dataType: LCD_XFER_CMD or LCD_XFER_DATA
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+static void LCD_follow(LcdMode* a_mode_Ptr, uint8 a_data, uint8 a_dataType);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_nextAddress
+[Description] : This function is responsible for returning the DDRAM address the next data character of the lane
+				is written to, after the queued writes of the controller
+				
+[Args] :
+[in] Lcd* a_lcd_Ptr, uint8 a_ctrl:
+a_lcd_Ptr: pointer to the display handle
+a_ctrl: index of the controller
+[Returns] : The address, or LCD_ADDRESS_UNKNOWN if it is not known
+--------------------------------------------------------------------------------------------------------------- */
+static uint8 LCD_nextAddress(Lcd* a_lcd_Ptr, uint8 a_ctrl);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_laneXfer
+[Description] : This function is responsible for returning a place in the circular queue of a lane
+				
+[Args] :
+[in] LcdController* a_ctrl_Ptr, uint8 a_lane, uint8 a_index:
+a_ctrl_Ptr: pointer to the controller
+a_lane: LCD_LANE_BACKGROUND or LCD_LANE_URGENT
+a_index: index of the write from the head of the queue
+[Returns] : pointer to the queued write
+--------------------------------------------------------------------------------------------------------------- */
+static LcdXfer* LCD_laneXfer(LcdController* a_ctrl_Ptr, uint8 a_lane, uint8 a_index);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_execTime
+[Description] : This function is responsible for returning the time needed by the controller to execute a write
+				
+[Args] :
+[in] uint8 a_data, uint8 a_dataType:
+a_data: The data or command written
+a_dataType: LCD_XFER_CMD or LCD_XFER_DATA
+[Returns] : The execution time in micro seconds
+--------------------------------------------------------------------------------------------------------------- */
+static uint16 LCD_execTime(uint8 a_data, uint8 a_dataType);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_waitDeadline
+[Description] : This function is responsible for waiting till the bus time reaches a controller busy deadline, the
+				deadline is ignored if it is already reached or if it is older than the longest execution time
+				
+[Args] :
+[in] uint16 a_deadline:
+a_deadline: bus time in micro seconds
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+static void LCD_waitDeadline(uint16 a_deadline);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_writeBus
+[Description] : This function is responsible for putting one nibble (4-bit mode) or one byte (8-bit mode) on the 
+				data pins of a display without toggling the enable pin, so the same prepared value can be read by
+				one or more displays sharing the bus
+				
+[Args] :
+[in] Lcd* a_lcd_Ptr, uint8 a_value:
+a_lcd_Ptr: pointer to the display handle which its data pins are used
+a_value: the nibble or byte to be put on the data pins, bit 0 goes to s_data[0]
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+static void LCD_writeBus(Lcd* a_lcd_Ptr, uint8 a_value);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_resetWrite
+[Description] : This function is responsible for writing one function set of the reset sequence to all the
+				controllers of a display, as a single enable pulse
+				
+[Args] :
+[in] Lcd* a_lcd_Ptr, uint8 a_function:
+a_lcd_Ptr: pointer to the display handle
+a_function: LCD_FUNCTION_RESET or LCD_FUNCTION_4BIT, only its high nibble is read by the controller
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+static void LCD_resetWrite(Lcd* a_lcd_Ptr, uint8 a_function);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_busRead
+[Description] : This function is responsible for reading one byte from a controller, the busy flag and address 
+				counter (command) or the DDRAM character at the address counter (data)
+				
+[Args] :
+[in] Lcd* a_lcd_Ptr, uint8 a_ctrl, uint8 a_dataType:
+a_lcd_Ptr: pointer to the display handle
+a_ctrl: index of the controller
+a_dataType: LCD_XFER_CMD or LCD_XFER_DATA
+[Returns] : The byte read
+--------------------------------------------------------------------------------------------------------------- */
+static uint8 LCD_busRead(Lcd* a_lcd_Ptr, uint8 a_ctrl, uint8 a_dataType);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_readBus
+[Description] : This function is responsible for reading one nibble (4-bit mode) or one byte (8-bit mode) from the
+				data pins of a display
+				
+[Args] :
+[in] Lcd* a_lcd_Ptr:
+a_lcd_Ptr: pointer to the display handle which its data pins are used
+[Returns] : The nibble or byte read, bit 0 comes from s_data[0]
+--------------------------------------------------------------------------------------------------------------- */
+static uint8 LCD_readBus(Lcd* a_lcd_Ptr);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_readData
+[Description] : This function is responsible for reading the DDRAM character at the address counter of a controller
+				when it is not busy anymore, the address counter moves to the next character
+				
+[Args] :
+[in] Lcd* a_lcd_Ptr, uint8 a_ctrl:
+a_lcd_Ptr: pointer to the display handle
+a_ctrl: index of the controller
+[Returns] : The character read
+--------------------------------------------------------------------------------------------------------------- */
+static uint8 LCD_readData(Lcd* a_lcd_Ptr, uint8 a_ctrl);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_prepare
+[Description] : This function is responsible for setting the pin directions of a display, emptying its queues and
+				adding it to the scheduler list
+				
+[Args] :
+[in] Lcd* a_lcd_Ptr:
+a_lcd_Ptr: pointer to the display handle
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+static void LCD_prepare(Lcd* a_lcd_Ptr);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_coldStart
+[Description] : This function is responsible for sending the initialization commands and clearing the display
+				
+[Args] :
+[in] Lcd* a_lcd_Ptr, uint8 a_cursorState:
+a_lcd_Ptr: pointer to the display handle
+a_cursorState: LCD_CURSOR_OFF or LCD_CURSOR_ON
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+static void LCD_coldStart(Lcd* a_lcd_Ptr, uint8 a_cursorState);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_scrubMode
+[Description] : This function is responsible for sending again the display control and entry mode of each controller
+				of a display and checking its number of lines and interface mode with the warm start probe
+				
+[Args] :
+[in] Lcd* a_lcd_Ptr:
+a_lcd_Ptr: pointer to the display handle
+[Returns] : 1 if the controllers answer as expected, 0 if the display must be initialized again
+--------------------------------------------------------------------------------------------------------------- */
+static uint8 LCD_scrubMode(Lcd* a_lcd_Ptr);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_scrubRestart
+[Description] : This function is responsible for initializing again a display which doesn't answer as expected, the
+				back buffer of its frame is kept and written again on the cleared display
+				
+[Args] :
+[in] Lcd* a_lcd_Ptr:
+a_lcd_Ptr: pointer to the display handle, it must have a frame
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+static void LCD_scrubRestart(Lcd* a_lcd_Ptr);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_enRead
+[Description] : This inline function is responsible for one read enable cycle of a controller
+				
+[Args] :
+[in] Lcd* a_lcd_Ptr, uint8 a_ctrl:
+a_lcd_Ptr: pointer to the display handle
+a_ctrl: index of the controller
+[Returns] : The nibble (4-bit mode) or byte (8-bit mode) read
+--------------------------------------------------------------------------------------------------------------- */
+static inline uint8 LCD_enRead(Lcd* a_lcd_Ptr, uint8 a_ctrl);
+
+static inline void LCD_enHigh(Lcd* a_lcd_Ptr, uint8 a_ctrl);
+static inline void LCD_enLow(Lcd* a_lcd_Ptr, uint8 a_ctrl);
+static inline void LCD_enToggle(Lcd* a_lcd_Ptr, uint8 a_ctrl);
+static inline void LCD_rsHigh(Lcd* a_lcd_Ptr);
+static inline void LCD_rsLow(Lcd* a_lcd_Ptr);
+static inline void LCD_rwHigh(Lcd* a_lcd_Ptr);
+static inline void LCD_rwLow(Lcd* a_lcd_Ptr);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_setDataPin
+[Description] :	This function is responsible for setting the port and pin number of one data line of a display
+				
+[Args] :
+[in] Lcd* a_lcd_Ptr, uint8 a_bit, uint8 a_lcdPort, uint8 a_lcdPin:
+a_lcd_Ptr: pointer to the display handle
+a_bit: index of the data line, [0-7] D0-D7 in 8-bit mode or [0-3] for D4-D7 in 4-bit mode
+a_lcdPort: PORT Which the line is connect with: 'A 'B' 'C' or 'D'
+a_lcdPin: Pin number in the PORT: [0-7]
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+void LCD_setDataPin(Lcd* a_lcd_Ptr, uint8 a_bit, uint8 a_lcdPort, uint8 a_lcdPin)
+{
+	if (a_bit < LCD_IO_MODE)
+	{
+		LCD_pinConfig(& a_lcd_Ptr->s_data[a_bit], a_lcdPort, a_lcdPin);
+	}
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_setControlPins
+[Description] :	This function is responsible for setting the port and pin number of the RS, RW and EN lines of a 
+				display
+				
+[Args] :
+[in] Lcd* a_lcd_Ptr, uint8 a_rsPort, uint8 a_rsPin, uint8 a_rwPort, uint8 a_rwPin, uint8 a_enPort, uint8 a_enPin:
+a_lcd_Ptr: pointer to the display handle
+a_rsPort, a_rsPin: port and pin of the RS line
+a_rwPort, a_rwPin: port and pin of the RW line
+a_enPort, a_enPin: port and pin of the EN line
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+void LCD_setControlPins(Lcd* a_lcd_Ptr, uint8 a_rsPort, uint8 a_rsPin, uint8 a_rwPort, uint8 a_rwPin,
+						uint8 a_enPort, uint8 a_enPin)
+{
+	LCD_pinConfig(& a_lcd_Ptr->s_rs, a_rsPort, a_rsPin);
+	LCD_pinConfig(& a_lcd_Ptr->s_rw, a_rwPort, a_rwPin);
+	LCD_pinConfig(& a_lcd_Ptr->s_ctrl[0].s_en, a_enPort, a_enPin);
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_setEnablePin
+[Description] :	This function is responsible for setting the port and pin number of the EN line of one controller
+				of a display, it is used for the second controller of a 40x4 module
+				
+[Args] :
+[in] Lcd* a_lcd_Ptr, uint8 a_ctrl, uint8 a_enPort, uint8 a_enPin:
+a_lcd_Ptr: pointer to the display handle
+a_ctrl: index of the controller [0-LCD_MAX_CONTROLLERS-1]
+a_enPort, a_enPin: port and pin of the EN line
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+void LCD_setEnablePin(Lcd* a_lcd_Ptr, uint8 a_ctrl, uint8 a_enPort, uint8 a_enPin)
+{
+	if (a_ctrl < LCD_MAX_CONTROLLERS)
+	{
+		LCD_pinConfig(& a_lcd_Ptr->s_ctrl[a_ctrl].s_en, a_enPort, a_enPin);
+	}
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_shareBus
+[Description] :	This function is responsible for making a display use the same data, RS and RW lines of another 
+				display, and only give it its own EN line
+				
+[Args] :
+[in] Lcd* a_lcd_Ptr, const Lcd* a_busOwner_Ptr, uint8 a_enPort, uint8 a_enPin:
+a_lcd_Ptr: pointer to the display handle to be configured
+a_busOwner_Ptr: pointer to the display which its data and RS/RW lines are shared
+a_enPort, a_enPin: port and pin of the EN line of a_lcd_Ptr
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+void LCD_shareBus(Lcd* a_lcd_Ptr, const Lcd* a_busOwner_Ptr, uint8 a_enPort, uint8 a_enPin)
+{
+	uint8 loop;
+	
+	for (loop=0;loop<LCD_IO_MODE;loop++)
+	{
+		a_lcd_Ptr->s_data[loop] = a_busOwner_Ptr->s_data[loop];
+	}
+	a_lcd_Ptr->s_rs = a_busOwner_Ptr->s_rs;
+	a_lcd_Ptr->s_rw = a_busOwner_Ptr->s_rw;
+	LCD_pinConfig(& a_lcd_Ptr->s_ctrl[0].s_en, a_enPort, a_enPin);
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_setGeometry
+[Description] :	This function is responsible for setting the number of lines and characters per line of a display
+				and calculate the DDRAM address of the first character of each line, lines 3 and 4 start right
+				after the end of lines 1 and 2.
+				If the display has more than 80 characters (40x4) it has two controllers, lines 3 and 4 are driven 
+				by the second one and start at the same addresses of lines 1 and 2, its enable pin is set by
+				LCD_setEnablePin (LCD_MAX_CONTROLLERS must then be 2)
+				
+[Args] :
+[in] Lcd* a_lcd_Ptr, uint8 a_lines, uint8 a_length:
+a_lcd_Ptr: pointer to the display handle
+a_lines: number of lines [1-LCD_MAX_LINES]
+a_length: visible characters per line
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+void LCD_setGeometry(Lcd* a_lcd_Ptr, uint8 a_lines, uint8 a_length)
+{
+	if (a_lines > LCD_MAX_LINES)
+	{
+		a_lines = LCD_MAX_LINES;
+	}
+	a_lcd_Ptr->s_lines			= a_lines;
+	a_lcd_Ptr->s_length			= a_length;
+	a_lcd_Ptr->s_lineStart[0]	= LCD_START_LINE1;
+	a_lcd_Ptr->s_lineStart[1]	= LCD_START_LINE2;
+	a_lcd_Ptr->s_lineCtrl[0]	= 0;
+	a_lcd_Ptr->s_lineCtrl[1]	= 0;
+	
+	if ((LCD_MAX_CONTROLLERS > 1) && ((uint16)a_lines * a_length > 80))
+	{
+		/* 40x4 module, the second controller drives lines 3 and 4 from its own first address */
+		a_lcd_Ptr->s_controllers	= 2;
+		a_lcd_Ptr->s_lineStart[2]	= LCD_START_LINE1;
+		a_lcd_Ptr->s_lineStart[3]	= LCD_START_LINE2;
+		a_lcd_Ptr->s_lineCtrl[2]	= 1;
+		a_lcd_Ptr->s_lineCtrl[3]	= 1;
+	}
+	else
+	{
+		/* line 3 and 4 are the continuation of line 1 and 2 in the DDRAM */
+		a_lcd_Ptr->s_controllers	= 1;
+		a_lcd_Ptr->s_lineStart[2]	= LCD_START_LINE1 + a_length;
+		a_lcd_Ptr->s_lineStart[3]	= LCD_START_LINE2 + a_length;
+		a_lcd_Ptr->s_lineCtrl[2]	= 0;
+		a_lcd_Ptr->s_lineCtrl[3]	= 0;
+	}
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_prepare
+[Description] : This function is responsible for setting the pin directions of a display, emptying its queues and
+				adding it to the scheduler list
+				
+[Args] :
+[in] Lcd* a_lcd_Ptr:
+a_lcd_Ptr: pointer to the display handle
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+static void LCD_prepare(Lcd* a_lcd_Ptr)
+{
+	uint8 loop;
+	Lcd* lcd_Ptr;
+	
+	/*	set the direction of the data and control pins of this display */
+	LCD_configurations(a_lcd_Ptr);
+	
+	/*	empty the write queues, the controllers are not busy and their address counters are not known yet */
+	for (loop=0;loop<a_lcd_Ptr->s_controllers;loop++)
+	{
+		a_lcd_Ptr->s_ctrl[loop].s_deadline	= g_s_busClock;
+		a_lcd_Ptr->s_ctrl[loop].s_mode.s_address		= LCD_ADDRESS_UNKNOWN;
+		a_lcd_Ptr->s_ctrl[loop].s_mode.s_entryMode		= LCD_ADDRESS_UNKNOWN;
+		a_lcd_Ptr->s_ctrl[loop].s_mode.s_dispCtrl		= LCD_ADDRESS_UNKNOWN;
+		a_lcd_Ptr->s_ctrl[loop].s_mode.s_writtenLo		= LCD_ADDRESS_UNKNOWN;
+		a_lcd_Ptr->s_ctrl[loop].s_lane[LCD_LANE_BACKGROUND].s_head		= 0;
+		a_lcd_Ptr->s_ctrl[loop].s_lane[LCD_LANE_BACKGROUND].s_count		= 0;
+		a_lcd_Ptr->s_ctrl[loop].s_lane[LCD_LANE_BACKGROUND].s_address	= LCD_ADDRESS_UNKNOWN;
+		a_lcd_Ptr->s_ctrl[loop].s_lane[LCD_LANE_URGENT].s_head			= 0;
+		a_lcd_Ptr->s_ctrl[loop].s_lane[LCD_LANE_URGENT].s_count			= 0;
+		a_lcd_Ptr->s_ctrl[loop].s_lane[LCD_LANE_URGENT].s_address		= LCD_ADDRESS_UNKNOWN;
+	}
+	a_lcd_Ptr->s_lane = LCD_LANE_BACKGROUND;
+	a_lcd_Ptr->s_activeCtrl[LCD_LANE_BACKGROUND]	= 0;
+	a_lcd_Ptr->s_activeCtrl[LCD_LANE_URGENT]		= 0;
+	a_lcd_Ptr->s_scrubRow	= 0;
+	a_lcd_Ptr->s_scrubCol	= 0;
+	a_lcd_Ptr->s_entryMode	= LCD_ADDRESS_UNKNOWN;
+	a_lcd_Ptr->s_rtlEnd		= 0;
+	if (a_lcd_Ptr->s_frame_Ptr != 0)
+	{
+		a_lcd_Ptr->s_frame_Ptr->s_row		= 0;
+		a_lcd_Ptr->s_frame_Ptr->s_col		= 0;
+		LCD_frameCursorLost(a_lcd_Ptr->s_frame_Ptr);
+	}
+	if (a_lcd_Ptr->s_cmdCost == 0)
+	{
+		LCD_setCostInst(a_lcd_Ptr, LCD_COST_DATA_US, LCD_COST_CMD_US);
+	}
+	
+	/*	add the display to the scheduler list if it is not there already */
+	for (lcd_Ptr=g_s_lcdList; (lcd_Ptr != a_lcd_Ptr) && (lcd_Ptr != 0); lcd_Ptr=lcd_Ptr->s_next)
+	{
+	}
+	if (lcd_Ptr == 0)
+	{
+		a_lcd_Ptr->s_next = g_s_lcdList;
+		g_s_lcdList = a_lcd_Ptr;
+	}
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_initInst
+[Description] :	This function is responsible for initialize the lcd data and control pins of a display by setting 
+				their direction, Prepare LCD to understand the 4-bit mode or 8-bit mode and set cursor ON/OFF state
+				and clear the LCD.
+				
+[Args] :
+[in] Lcd* a_lcd_Ptr, uint8 a_cursorState:
+a_lcd_Ptr: pointer to the display handle
+a_cursorState is uint8 for the cursor state, LCD_CURSOR_OFF or LCD_CURSOR_ON
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+void LCD_initInst(Lcd* a_lcd_Ptr, uint8 a_cursorState)
+{
+	LCD_prepare(a_lcd_Ptr);
+	LCD_coldStart(a_lcd_Ptr, a_cursorState);
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_warmInitInst
+[Description] :	This function is responsible for initializing a display without clearing it if the controller is
+				still configured, the probe is done on each controller, and the DDRAM of each line is read back into
+				both buffers of the attached frame
+				
+[Args] :
+[in] Lcd* a_lcd_Ptr, uint8 a_cursorState:
+a_lcd_Ptr: pointer to the display handle
+a_cursorState is uint8 for the cursor state, LCD_CURSOR_OFF or LCD_CURSOR_ON
+[Returns] : LCD_START_WARM if the display is kept as it is, or LCD_START_COLD if it is initialized and cleared
+--------------------------------------------------------------------------------------------------------------- */
+uint8 LCD_warmInitInst(Lcd* a_lcd_Ptr, uint8 a_cursorState)
+{
+	LcdFrame* frame_Ptr = a_lcd_Ptr->s_frame_Ptr;
+	uint8 ctrl;
+	uint8 row;
+	uint8 col;
+	uint8 status;
+	
+	LCD_prepare(a_lcd_Ptr);
+	
+	for (ctrl=0;ctrl<a_lcd_Ptr->s_controllers;ctrl++)
+	{
+		/* nothing is written before the busy flag and address counter are read twice the same, not busy and
+		*  inside the DDRAM lines, a floating bus or a nibble slip of the 4-bit mode reads differently
+		*/
+		status = LCD_busRead(a_lcd_Ptr, ctrl, LCD_XFER_CMD);
+		if ((status != LCD_busRead(a_lcd_Ptr, ctrl, LCD_XFER_CMD)) || (status & LCD_BUSY_FLAG) ||
+			((a_lcd_Ptr->s_lines == 1) ? (status > 0x4F) : ((status & 0x3F) > LCD_PROBE_ADDRESS)))
+		{
+			LCD_coldStart(a_lcd_Ptr, a_cursorState);
+			return LCD_START_COLD;
+		}
+	}
+	
+	for (ctrl=0;ctrl<a_lcd_Ptr->s_controllers;ctrl++)
+	{
+		/* the address after the last character of the first line depends on the number of lines */
+		LCD_transfer(a_lcd_Ptr, ctrl, LCD_ENTRY_INC, LCD_XFER_CMD);
+		a_lcd_Ptr->s_entryMode = LCD_ENTRY_INC;
+		LCD_transfer(a_lcd_Ptr, ctrl, SET_CURSOR_LOCATION | LCD_PROBE_ADDRESS, LCD_XFER_CMD);
+		(void)LCD_readData(a_lcd_Ptr, ctrl);
+		LCD_waitDeadline(a_lcd_Ptr->s_ctrl[ctrl].s_deadline);
+		status = LCD_busRead(a_lcd_Ptr, ctrl, LCD_XFER_CMD);
+		if (status != ((a_lcd_Ptr->s_lines == 1) ? LCD_PROBE_NEXT_1LINE : LCD_PROBE_NEXT_2LINE))
+		{
+			/* dead, not configured, or out of nibble sync */
+			LCD_coldStart(a_lcd_Ptr, a_cursorState);
+			return LCD_START_COLD;
+		}
+	}
+	
+	/* the controllers are alive, only the cursor state is set, nothing is cleared */
+	a_lcd_Ptr->s_dispCtrl = a_cursorState;
+	for (ctrl=0;ctrl<a_lcd_Ptr->s_controllers;ctrl++)
+	{
+		LCD_transfer(a_lcd_Ptr, ctrl, a_cursorState, LCD_XFER_CMD);
+	}
+	if (frame_Ptr != 0)
+	{
+		for (row=0;row<a_lcd_Ptr->s_lines;row++)
+		{
+			ctrl = a_lcd_Ptr->s_lineCtrl[row];
+			LCD_transfer(a_lcd_Ptr, ctrl, SET_CURSOR_LOCATION | a_lcd_Ptr->s_lineStart[row], LCD_XFER_CMD);
+			for (col=0;(col<a_lcd_Ptr->s_length) && (col<LCD_MAX_LENGTH);col++)
+			{
+				frame_Ptr->s_front[row][col] = LCD_readData(a_lcd_Ptr, ctrl);
+				frame_Ptr->s_back[row][col] = frame_Ptr->s_front[row][col];
+			}
+		}
+		frame_Ptr->s_dirty = 0;
+	}
+	for (ctrl=0;ctrl<a_lcd_Ptr->s_controllers;ctrl++)
+	{
+		LCD_transfer(a_lcd_Ptr, ctrl, SET_CURSOR_LOCATION | LCD_START_LINE1, LCD_XFER_CMD);
+		/* the reads moved the address counter */
+		a_lcd_Ptr->s_ctrl[ctrl].s_mode.s_address = LCD_START_LINE1;
+	}
+	if (frame_Ptr != 0)
+	{
+		LCD_frameCursorLost(frame_Ptr);
+	}
+	if (a_lcd_Ptr->s_crc_Ptr != 0)
+	{
+		a_lcd_Ptr->s_crc_Ptr->s_nextRow = LCD_ADDRESS_UNKNOWN;
+	}
+	return LCD_START_WARM;
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_scrubInst
+[Description] :	This function is responsible for checking a few DDRAM cells of a display with a frame and writing
+				again the ones which are not the front buffer, each sweep of the screen starts with the mode check
+				of LCD_scrubMode
+				
+[Args] :
+[in] Lcd* a_lcd_Ptr, uint8 a_cells:
+a_lcd_Ptr: pointer to the display handle
+a_cells: number of cells checked by this call
+[Returns] : LCD_SCRUB_CLEAN, LCD_SCRUB_REPAIRED, LCD_SCRUB_REINIT or LCD_SCRUB_SKIPPED
+--------------------------------------------------------------------------------------------------------------- */
+uint8 LCD_scrubInst(Lcd* a_lcd_Ptr, uint8 a_cells)
+{
+	LcdFrame* frame_Ptr = a_lcd_Ptr->s_frame_Ptr;
+	LcdController* ctrl_Ptr;
+	LcdMode next;
+	uint8 result = LCD_SCRUB_CLEAN;
+	uint8 ctrl;
+	uint8 row;
+	uint8 col;
+	uint8 address;
+	uint8 value;
+	uint8 status;
+	
+	if ((frame_Ptr == 0) || (frame_Ptr->s_hold != 0))
+	{
+		return LCD_SCRUB_SKIPPED;
+	}
+	for (ctrl=0;ctrl<a_lcd_Ptr->s_controllers;ctrl++)
+	{
+		/* the front buffer is on the display only when all its writes are sent */
+		if ((a_lcd_Ptr->s_ctrl[ctrl].s_lane[LCD_LANE_BACKGROUND].s_count != 0) ||
+			(a_lcd_Ptr->s_ctrl[ctrl].s_lane[LCD_LANE_URGENT].s_count != 0))
+		{
+			return LCD_SCRUB_SKIPPED;
+		}
+	}
+	
+	for (;a_cells!=0;a_cells--)
+	{
+		row = a_lcd_Ptr->s_scrubRow;
+		col = a_lcd_Ptr->s_scrubCol;
+		if ((row == 0) && (col == 0) && (LCD_scrubMode(a_lcd_Ptr) == 0))
+		{
+			LCD_scrubRestart(a_lcd_Ptr);
+			return LCD_SCRUB_REINIT;
+		}
+		ctrl = a_lcd_Ptr->s_lineCtrl[row];
+		ctrl_Ptr = & a_lcd_Ptr->s_ctrl[ctrl];
+		address = a_lcd_Ptr->s_lineStart[row] + col;
+		if (ctrl_Ptr->s_mode.s_address != address)
+		{
+			LCD_transfer(a_lcd_Ptr, ctrl, SET_CURSOR_LOCATION | address, LCD_XFER_CMD);
+		}
+		value = LCD_readData(a_lcd_Ptr, ctrl);
+		
+		/* the read moves the address counter as a write does, a controller out of sync answers elsewhere */
+		next = ctrl_Ptr->s_mode;
+		LCD_follow(& next, value, LCD_XFER_DATA);
+		LCD_waitDeadline(ctrl_Ptr->s_deadline);
+		status = LCD_busRead(a_lcd_Ptr, ctrl, LCD_XFER_CMD);
+		if ((status & LCD_BUSY_FLAG) || ((next.s_address != LCD_ADDRESS_UNKNOWN) && (status != next.s_address)))
+		{
+			LCD_scrubRestart(a_lcd_Ptr);
+			return LCD_SCRUB_REINIT;
+		}
+		ctrl_Ptr->s_mode.s_address = status;
+		
+		if (value != frame_Ptr->s_front[row][col])
+		{
+			LCD_transfer(a_lcd_Ptr, ctrl, SET_CURSOR_LOCATION | address, LCD_XFER_CMD);
+			LCD_transfer(a_lcd_Ptr, ctrl, frame_Ptr->s_front[row][col], LCD_XFER_DATA);
+			a_lcd_Ptr->s_stats.s_scrubRepairs++;
+			result = LCD_SCRUB_REPAIRED;
+		}
+		
+		if (++a_lcd_Ptr->s_scrubCol >= a_lcd_Ptr->s_length)
+		{
+			a_lcd_Ptr->s_scrubCol = 0;
+			if (++a_lcd_Ptr->s_scrubRow >= a_lcd_Ptr->s_lines)
+			{
+				a_lcd_Ptr->s_scrubRow = 0;
+			}
+		}
+	}
+	/* the cursor is not where the frame planner left it */
+	LCD_frameCursorLost(frame_Ptr);
+	return result;
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_scrubMode
+[Description] : This function is responsible for sending again the display control and entry mode of each controller
+				of a display, a noise glitch may have turned the display off, then with the increment entry mode the
+				cursor is set to LCD_PROBE_ADDRESS and one character is read, the address counter must then be at
+				the address which follows it with the number of lines of the display
+				
+[Args] :
+[in] Lcd* a_lcd_Ptr:
+a_lcd_Ptr: pointer to the display handle
+[Returns] : 1 if the controllers answer as expected, 0 if the display must be initialized again
+--------------------------------------------------------------------------------------------------------------- */
+static uint8 LCD_scrubMode(Lcd* a_lcd_Ptr)
+{
+	LcdMode* mode_Ptr;
+	uint8 ctrl;
+	uint8 status;
+	
+	for (ctrl=0;ctrl<a_lcd_Ptr->s_controllers;ctrl++)
+	{
+		mode_Ptr = & a_lcd_Ptr->s_ctrl[ctrl].s_mode;
+		LCD_transfer(a_lcd_Ptr, ctrl, (mode_Ptr->s_dispCtrl != LCD_ADDRESS_UNKNOWN) ? mode_Ptr->s_dispCtrl :
+					 a_lcd_Ptr->s_dispCtrl, LCD_XFER_CMD);
+		if (mode_Ptr->s_entryMode == LCD_ADDRESS_UNKNOWN)
+		{
+			continue;
+		}
+		LCD_transfer(a_lcd_Ptr, ctrl, mode_Ptr->s_entryMode, LCD_XFER_CMD);
+		if (mode_Ptr->s_entryMode & (LCD_ENTRY_INC ^ LCD_ENTRY_DEC))
+		{
+			LCD_transfer(a_lcd_Ptr, ctrl, SET_CURSOR_LOCATION | LCD_PROBE_ADDRESS, LCD_XFER_CMD);
+			(void)LCD_readData(a_lcd_Ptr, ctrl);
+			LCD_waitDeadline(a_lcd_Ptr->s_ctrl[ctrl].s_deadline);
+			status = LCD_busRead(a_lcd_Ptr, ctrl, LCD_XFER_CMD);
+			if (status != ((a_lcd_Ptr->s_lines == 1) ? LCD_PROBE_NEXT_1LINE : LCD_PROBE_NEXT_2LINE))
+			{
+				return 0;
+			}
+			mode_Ptr->s_address = status;
+		}
+	}
+	return 1;
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_scrubRestart
+[Description] : This function is responsible for initializing again a display which doesn't answer as expected, the
+				frame is detached during the initialization so its clear display doesn't empty the back buffer, then
+				the front buffer is blank like the display and all the lines are written again
+				
+[Args] :
+[in] Lcd* a_lcd_Ptr:
+a_lcd_Ptr: pointer to the display handle, it must have a frame
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+static void LCD_scrubRestart(Lcd* a_lcd_Ptr)
+{
+	LcdFrame* frame_Ptr = a_lcd_Ptr->s_frame_Ptr;
+	uint8 row;
+	uint8 col;
+	
+	a_lcd_Ptr->s_frame_Ptr = 0;
+	LCD_prepare(a_lcd_Ptr);
+	LCD_coldStart(a_lcd_Ptr, a_lcd_Ptr->s_dispCtrl);
+	a_lcd_Ptr->s_frame_Ptr = frame_Ptr;
+	for (row=0;row<LCD_MAX_LINES;row++)
+	{
+		for (col=0;col<LCD_MAX_LENGTH;col++)
+		{
+			frame_Ptr->s_front[row][col] = ' ';
+		}
+		if (row < a_lcd_Ptr->s_lines)
+		{
+			frame_Ptr->s_dirty |= (1 << row);
+		}
+	}
+	LCD_frameCursorLost(frame_Ptr);
+	a_lcd_Ptr->s_stats.s_scrubResets++;
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_coldStart
+[Description] : This function is responsible for sending the initialization commands and clearing the display, it
+				waits till they are sent if no batch is started
+				
+[Args] :
+[in] Lcd* a_lcd_Ptr, uint8 a_cursorState:
+a_lcd_Ptr: pointer to the display handle
+a_cursorState: LCD_CURSOR_OFF or LCD_CURSOR_ON
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+static void LCD_coldStart(Lcd* a_lcd_Ptr, uint8 a_cursorState)
+{
+	uint8 ctrl;
+	uint16 ms;
+	
+	if (g_s_powered == 0)
+	{
+		/* slept one milli second at a time, the wait in micro seconds doesn't fit the 16-bit TIMER0_sleepUs */
+		for (ms=0;ms<LCD_POWER_ON_MS;ms++)
+		{
+			if (LCD_SLEPT(1000U) == 0)
+			{
+				_delay_ms(1);
+			}
+		}
+		g_s_powered = 1;
+	}
+	
+	/*	Initialization by instruction, the controller may be in 8-bit mode, in 4-bit mode or half way through a
+	*	byte in 4-bit mode (MCU reset during a write). Three function sets 0x3 bring it to 8-bit mode from any of
+	*	these states, they are sent as one nibble since D0-D3 may not be connected, then 0x2 selects 4-bit mode
+	*/
+	LCD_resetWrite(a_lcd_Ptr, LCD_FUNCTION_RESET);
+	if (LCD_SLEPT(LCD_RESET1_US) == 0)
+	{
+		_delay_us(LCD_RESET1_US);
+	}
+	g_s_busClock += LCD_RESET1_US;
+	LCD_resetWrite(a_lcd_Ptr, LCD_FUNCTION_RESET);
+	_delay_us(LCD_RESET2_US);
+	g_s_busClock += LCD_RESET2_US;
+	LCD_resetWrite(a_lcd_Ptr, LCD_FUNCTION_RESET);
+	#if (LCD_IO_MODE==4)
+		_delay_us(LCD_EXEC_US);
+		g_s_busClock += LCD_EXEC_US;
+		LCD_resetWrite(a_lcd_Ptr, LCD_FUNCTION_4BIT);
+	#endif
+	for (ctrl=0;ctrl<a_lcd_Ptr->s_controllers;ctrl++)
+	{
+		a_lcd_Ptr->s_ctrl[ctrl].s_deadline = g_s_busClock + LCD_EXEC_US;
+	}
+	
+	/*  LCD_FUNCTION_DEFAULT is defined in the header file based on LCD_IO_MODE type, the number of lines bit
+	*	is taken from this display geometry
+	*	(1 or 2)-line lcd + (4 or 8)-bit Data Mode + 5*7 dot display Mode 
+	*/
+	if (a_lcd_Ptr->s_lines == 1)
+	{
+		LCD_sendCommandInst(a_lcd_Ptr, LCD_FUNCTION_DEFAULT & ~LCD_FUNCTION_LINES_BIT);
+	}
+	else
+	{
+		LCD_sendCommandInst(a_lcd_Ptr, LCD_FUNCTION_DEFAULT | LCD_FUNCTION_LINES_BIT);
+	}
+	
+	/*	clear LCD before turning it on so the old content isn't shown, the entry mode is not reset by the 0x3
+	*	sequence, then setting cursor state ON/OFF
+	*/
+	LCD_sendCommandInst(a_lcd_Ptr, LCD_CLR); 
+	LCD_sendCommandInst(a_lcd_Ptr, LCD_ENTRY_INC);
+	a_lcd_Ptr->s_dispCtrl = a_cursorState;
+	LCD_sendCommandInst(a_lcd_Ptr, a_cursorState);
+	
+	/* the writes of a display with a frame are not sent by LCD_write, the init is blocking anyway */
+	if ((a_lcd_Ptr->s_frame_Ptr != 0) && (g_s_batch == 0))
+	{
+		LCD_flushInst(a_lcd_Ptr);
+	}
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_sendCommandInst
+[Description] : This function is responsible for sending command to the lcd, it call the LCD_write function which
+				takes two parameters, 1st the data to be sent to LCD, and the data type whether it's a data character 
+				or a command byte, so we call LCD_write and send LCD_XFER_CMD to indicate that it's a command
+				
+[Args] :
+[in] Lcd* a_lcd_Ptr, uint8 a_command:
+a_lcd_Ptr: pointer to the display handle
+a_command: The command to be executed in the LCD
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+void LCD_sendCommandInst(Lcd* a_lcd_Ptr, uint8 a_command)
+{
+	if (a_lcd_Ptr->s_frame_Ptr != 0)
+	{
+		/* the command may move the cursor, the next frame cell is written with its address */
+		LCD_frameCursorLost(a_lcd_Ptr->s_frame_Ptr);
+	}
+	if (a_lcd_Ptr->s_crc_Ptr != 0)
+	{
+		a_lcd_Ptr->s_crc_Ptr->s_nextRow = LCD_ADDRESS_UNKNOWN;
+	}
+	LCD_write(a_lcd_Ptr, a_command, LCD_XFER_CMD);
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_broadcastCommand
+[Description] : This function is responsible for sending the same command to many displays which share the same data
+				and RS/RW lines, the data lines are prepared once for each nibble and then the EN line of every
+				controller of every display is toggled, so clearing or configuring N displays costs one bus setup 
+				instead of N.
+				The queued writes are sent first and the command is sent when all the controllers are not busy
+				
+[Args] :
+[in] Lcd* const* a_lcds_Ptr, uint8 a_count, uint8 a_command:
+a_lcds_Ptr: array of pointers to the display handles, all of them must share the data and RS/RW lines
+a_count: number of displays in the array
+a_command: The command to be executed in the displays
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+void LCD_broadcastCommand(Lcd* const* a_lcds_Ptr, uint8 a_count, uint8 a_command)
+{
+	uint8 loop;
+	uint8 ctrl;
+	uint8 nibble;
+	uint16 deadline;
+	/* the bus is driven through the pins of the first display, they are the same for all the others */
+	Lcd* bus_Ptr = a_lcds_Ptr[0];
+	
+	/* keep the order of the writes, and wait for the controller which finishes its last write the latest */
+	LCD_flushAll();
+	for (loop=0;loop<a_count;loop++)
+	{
+		for (ctrl=0;ctrl<a_lcds_Ptr[loop]->s_controllers;ctrl++)
+		{
+			LCD_waitDeadline(a_lcds_Ptr[loop]->s_ctrl[ctrl].s_deadline);
+		}
+	}
+	
+	LCD_rsLow(bus_Ptr);
+	LCD_rwLow(bus_Ptr);
+	OSC_DELAY_NS(LCD_T_SETUP_NS);
+	
+	/* prepare the high nibble then the low nibble in 4-bit mode, or the whole byte once in 8-bit mode */
+	for (nibble=(LCD_IO_MODE == 4) ? 2 : 1; nibble>0; nibble--)
+	{
+		LCD_writeBus(bus_Ptr, (nibble == 2) ? (a_command >> 4) : a_command);
+		/* let every controller of every display read the prepared value */
+		for (loop=0;loop<a_count;loop++)
+		{
+			for (ctrl=0;ctrl<a_lcds_Ptr[loop]->s_controllers;ctrl++)
+			{
+				LCD_enToggle(a_lcds_Ptr[loop], ctrl);
+			}
+		}
+	}
+	
+	deadline = g_s_busClock + LCD_execTime(a_command, LCD_XFER_CMD);
+	for (loop=0;loop<a_count;loop++)
+	{
+		for (ctrl=0;ctrl<a_lcds_Ptr[loop]->s_controllers;ctrl++)
+		{
+			a_lcds_Ptr[loop]->s_ctrl[ctrl].s_deadline = deadline;
+			LCD_follow(& a_lcds_Ptr[loop]->s_ctrl[ctrl].s_mode, a_command, LCD_XFER_CMD);
+			a_lcds_Ptr[loop]->s_stats.s_cmdWrites++;
+		}
+	}
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_flushInst
+[Description] : This function is responsible for sending all the queued writes of a display, the scheduler sends the
+				queued writes of all the controllers on the bus in the order of their busy deadlines, so while a 
+				controller executes a write the bus is used to write to another one
+				
+[Args] :
+[in] Lcd* a_lcd_Ptr:
+a_lcd_Ptr: pointer to the display handle
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+void LCD_flushInst(Lcd* a_lcd_Ptr)
+{
+	uint8 ctrl;
+	
+	if (a_lcd_Ptr->s_frame_Ptr != 0)
+	{
+		/* queue all the changed cells, the scheduler sends writes when a queue is full */
+		g_s_batch++;
+		while (LCD_frameStep(a_lcd_Ptr))
+		{
+		}
+		g_s_batch--;
+	}
+	for (ctrl=0;ctrl<a_lcd_Ptr->s_controllers;ctrl++)
+	{
+		/* the scheduler may send writes of other controllers first if they are ready before this one */
+		while (((a_lcd_Ptr->s_ctrl[ctrl].s_lane[LCD_LANE_BACKGROUND].s_count != 0) ||
+				(a_lcd_Ptr->s_ctrl[ctrl].s_lane[LCD_LANE_URGENT].s_count != 0)) && LCD_scheduleStep())
+		{
+		}
+	}
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_flushAll
+[Description] : This function is responsible for sending all the queued writes of all the initialized displays
+				
+[Args] :
+[in] void:
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+void LCD_flushAll(void)
+{
+	while (LCD_scheduleStep())
+	{
+	}
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_beginBatch
+[Description] : This function is responsible for starting a batch, by default every LCD_xxx function sends its writes
+				before it returns, inside a batch the writes are only queued (and sent when a queue is full), so the
+				writes of different controllers or displays are overlapped when the batch ends.
+				Batches can be nested, the writes are sent by the last LCD_endBatch
+				
+[Args] :
+[in] void:
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+void LCD_beginBatch(void)
+{
+	g_s_batch++;
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_endBatch
+[Description] : This function is responsible for ending a batch started by LCD_beginBatch and sending all the queued
+				writes of all displays
+				
+[Args] :
+[in] void:
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+void LCD_endBatch(void)
+{
+	if (g_s_batch != 0)
+	{
+		g_s_batch--;
+	}
+	if (g_s_batch == 0)
+	{
+		LCD_flushAll();
+	}
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_setLaneInst
+[Description] : This function is responsible for choosing the lane of the next writes of a display, the urgent writes
+				are sent before the queued background writes at the next character boundary, even during a long 
+				flush of a background repaint if they are queued by the preempt hook, see LCD_setPreemptHook
+				
+[Args] :
+[in] Lcd* a_lcd_Ptr, uint8 a_lane:
+a_lcd_Ptr: pointer to the display handle
+a_lane: LCD_LANE_BACKGROUND or LCD_LANE_URGENT
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+void LCD_setLaneInst(Lcd* a_lcd_Ptr, uint8 a_lane)
+{
+	a_lcd_Ptr->s_lane = (a_lane == LCD_LANE_URGENT) ? LCD_LANE_URGENT : LCD_LANE_BACKGROUND;
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_setPreemptHook
+[Description] : This function is responsible for setting a function called by the scheduler before each write it 
+				sends, the hook can queue urgent writes (draining an LcdQueue of alarms for example) which are then
+				sent before the rest of the background writes. The hook runs like a batch, its writes are only
+				queued, and it is not called again while it runs
+				
+[Args] :
+[in] void (*a_hook_Ptr)(void):
+a_hook_Ptr: pointer to the hook function, or 0 to remove it
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+void LCD_setPreemptHook(void (*a_hook_Ptr)(void))
+{
+	g_s_preemptHook = a_hook_Ptr;
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_attachFrameInst
+[Description] : This function is responsible for attaching a frame buffer to a display, both buffers are filled
+				with spaces as the display is cleared by LCD_initInst
+				
+[Args] :
+[in] Lcd* a_lcd_Ptr, LcdFrame* a_frame_Ptr:
+a_lcd_Ptr: pointer to the display handle
+a_frame_Ptr: pointer to the frame buffer, or 0 to write the display directly again
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+void LCD_attachFrameInst(Lcd* a_lcd_Ptr, LcdFrame* a_frame_Ptr)
+{
+	a_lcd_Ptr->s_frame_Ptr = a_frame_Ptr;
+	if (a_frame_Ptr != 0)
+	{
+		LCD_frameFill(a_frame_Ptr, 1);
+		a_frame_Ptr->s_dirty	= 0;
+		a_frame_Ptr->s_row		= 0;
+		a_frame_Ptr->s_col		= 0;
+		a_frame_Ptr->s_hold		= 0;
+		LCD_frameCursorLost(a_frame_Ptr);
+	}
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_beginFrameInst
+[Description] : This function is responsible for starting the composition of the next screen of a display with a
+				frame, the changed cells of the back buffer are not written till LCD_commitFrameInst
+				
+[Args] :
+[in] Lcd* a_lcd_Ptr:
+a_lcd_Ptr: pointer to the display handle, it does nothing if the display has no frame
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+void LCD_beginFrameInst(Lcd* a_lcd_Ptr)
+{
+	if (a_lcd_Ptr->s_frame_Ptr != 0)
+	{
+		a_lcd_Ptr->s_frame_Ptr->s_hold = 1;
+	}
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_commitFrameInst
+[Description] : This function is responsible for ending the composition started by LCD_beginFrameInst and writing
+				the difference between the back and the front buffers in one burst
+				
+[Args] :
+[in] Lcd* a_lcd_Ptr:
+a_lcd_Ptr: pointer to the display handle, it does nothing if the display has no frame
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+void LCD_commitFrameInst(Lcd* a_lcd_Ptr)
+{
+	if (a_lcd_Ptr->s_frame_Ptr != 0)
+	{
+		a_lcd_Ptr->s_frame_Ptr->s_hold = 0;
+		LCD_flushInst(a_lcd_Ptr);
+	}
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_service
+[Description] : This function is responsible for writing the queued writes and the changed frame cells of all the
+				displays for a limited time, the frame cells are queued only when all the queues are empty, one
+				cell of each display at a time, so the writes of different controllers are still overlapped
+				
+[Args] :
+[in] uint16 a_budget_us:
+a_budget_us: the time in micro seconds the call can spend
+[Returns] : The number of queued writes and changed frame cells not written yet
+--------------------------------------------------------------------------------------------------------------- */
+uint16 LCD_service(uint16 a_budget_us)
+{
+	uint16 start = g_s_busClock;
+	uint16 used = 0;
+	uint8 queued;
+	Lcd* lcd_Ptr;
+	uint8 ctrl;
+	uint8 lane;
+	sint16 wait;
+	
+	/* the frame cells are only queued here, they are sent one by one inside the budget */
+	g_s_batch++;
+	while (1)
+	{
+		if (LCD_schedulePick(& lcd_Ptr, & ctrl, & lane, & wait) == 0)
+		{
+			queued = 0;
+			for (lcd_Ptr=g_s_lcdList; lcd_Ptr != 0; lcd_Ptr=lcd_Ptr->s_next)
+			{
+				if ((lcd_Ptr->s_frame_Ptr != 0) && LCD_frameStep(lcd_Ptr))
+				{
+					queued = 1;
+				}
+			}
+			if (queued == 0)
+			{
+				break;
+			}
+			continue;
+		}
+		
+		if (((uint32)used + (uint16)wait + LCD_BUS_US) > a_budget_us)
+		{
+			/* the controller is busy for longer than what is left, spend it waiting so the next call goes on */
+			if ((uint16)wait > (a_budget_us - used))
+			{
+				LCD_waitDeadline(g_s_busClock + (a_budget_us - used));
+			}
+			break;
+		}
+		LCD_scheduleStep();
+		used = g_s_busClock - start;
+	}
+	g_s_batch--;
+	
+	return LCD_workLeft();
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_setCostInst
+[Description] : This function is responsible for setting the cost of one data write and one command of a display
+				
+[Args] :
+[in] Lcd* a_lcd_Ptr, uint16 a_dataUs, uint16 a_cmdUs:
+a_lcd_Ptr: pointer to the display handle
+a_dataUs: time in micro seconds of one data write
+a_cmdUs: time in micro seconds of one command
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+void LCD_setCostInst(Lcd* a_lcd_Ptr, uint16 a_dataUs, uint16 a_cmdUs)
+{
+	a_lcd_Ptr->s_dataCost	= a_dataUs;
+	a_lcd_Ptr->s_cmdCost	= a_cmdUs;
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_getStatsInst
+[Description] : This function is responsible for copying the counters of a display
+				
+[Args] :
+[in] const Lcd* a_lcd_Ptr:
+a_lcd_Ptr: pointer to the display handle
+[out] LcdStats* a_stats_Ptr:
+a_stats_Ptr: the copy of the counters
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+void LCD_getStatsInst(const Lcd* a_lcd_Ptr, LcdStats* a_stats_Ptr)
+{
+	*a_stats_Ptr = a_lcd_Ptr->s_stats;
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_clearStatsInst
+[Description] : This function is responsible for setting all the counters of a display to zero
+				
+[Args] :
+[in] Lcd* a_lcd_Ptr:
+a_lcd_Ptr: pointer to the display handle
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+void LCD_clearStatsInst(Lcd* a_lcd_Ptr)
+{
+	a_lcd_Ptr->s_stats.s_dataWrites		= 0;
+	a_lcd_Ptr->s_stats.s_cmdWrites		= 0;
+	a_lcd_Ptr->s_stats.s_runs			= 0;
+	a_lcd_Ptr->s_stats.s_addressCmds	= 0;
+	a_lcd_Ptr->s_stats.s_joinedRuns		= 0;
+	a_lcd_Ptr->s_stats.s_resentCells	= 0;
+	a_lcd_Ptr->s_stats.s_continuedRuns	= 0;
+	a_lcd_Ptr->s_stats.s_savedUs		= 0;
+	a_lcd_Ptr->s_stats.s_peepholeDrops	= 0;
+	a_lcd_Ptr->s_stats.s_scrubRepairs	= 0;
+	a_lcd_Ptr->s_stats.s_scrubResets	= 0;
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_attachCrcFrameInst
+[Description] : This function is responsible for attaching span CRCs to a display, nothing is known about what the
+				display shows, so the first render sends all the drawn characters
+				
+[Args] :
+[in] Lcd* a_lcd_Ptr, LcdCrcFrame* a_crc_Ptr:
+a_lcd_Ptr: pointer to the display handle
+a_crc_Ptr: pointer to the span CRCs, or 0 to remove them
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+void LCD_attachCrcFrameInst(Lcd* a_lcd_Ptr, LcdCrcFrame* a_crc_Ptr)
+{
+	a_lcd_Ptr->s_crc_Ptr = a_crc_Ptr;
+	if (a_crc_Ptr != 0)
+	{
+		a_crc_Ptr->s_pass		= LCD_RENDER_OFF;
+		a_crc_Ptr->s_flags		= 0;
+		a_crc_Ptr->s_nextRow	= LCD_ADDRESS_UNKNOWN;
+	}
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_renderBeginInst
+[Description] : This function is responsible for starting the hash pass of a render, or the emit pass if the last
+				LCD_renderEndInst returned 1. The emit pass is a batch, its writes are sent by LCD_renderEndInst
+				
+[Args] :
+[in] Lcd* a_lcd_Ptr:
+a_lcd_Ptr: pointer to the display handle, it must have span CRCs
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+void LCD_renderBeginInst(Lcd* a_lcd_Ptr)
+{
+	LcdCrcFrame* crc_Ptr = a_lcd_Ptr->s_crc_Ptr;
+	uint8 loop;
+	
+	crc_Ptr->s_row = 0;
+	crc_Ptr->s_col = 0;
+	if (crc_Ptr->s_pass == LCD_RENDER_EMIT)
+	{
+		LCD_beginBatch();
+		if (crc_Ptr->s_flags & LCD_CRC_CLEARED)
+		{
+			/* the render clears the screen, it is cleared once and all the characters are sent */
+			LCD_write(a_lcd_Ptr, LCD_CLR, LCD_XFER_CMD);
+			crc_Ptr->s_nextRow = LCD_ADDRESS_UNKNOWN;
+		}
+		return;
+	}
+	
+	crc_Ptr->s_pass = LCD_RENDER_HASH;
+	crc_Ptr->s_flags &= ~(LCD_CRC_CLEARED | LCD_CRC_UNHASHED);
+	for (loop=0;loop<LCD_CRC_SEGMENTS;loop++)
+	{
+		crc_Ptr->s_work[loop] = 0;
+	}
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_renderEndInst
+[Description] : This function is responsible for ending a render pass, after the hash pass it compares the CRC of
+				each span with the one sent last time, after the emit pass it sends the queued writes and keeps the
+				new CRCs
+				
+[Args] :
+[in] Lcd* a_lcd_Ptr:
+a_lcd_Ptr: pointer to the display handle
+[Returns] : 1 if the application must draw again to send the changed spans, or 0 if the render is done
+--------------------------------------------------------------------------------------------------------------- */
+uint8 LCD_renderEndInst(Lcd* a_lcd_Ptr)
+{
+	LcdCrcFrame* crc_Ptr = a_lcd_Ptr->s_crc_Ptr;
+	uint8 loop;
+	uint8 changed;
+	
+	if (crc_Ptr->s_pass == LCD_RENDER_HASH)
+	{
+		changed = ((crc_Ptr->s_flags & (LCD_CRC_VALID | LCD_CRC_UNHASHED)) != LCD_CRC_VALID);
+		for (loop=0;(loop<LCD_CRC_SEGMENTS) && (changed == 0);loop++)
+		{
+			changed = (crc_Ptr->s_work[loop] != crc_Ptr->s_hash[loop]);
+		}
+		crc_Ptr->s_pass = changed ? LCD_RENDER_EMIT : LCD_RENDER_OFF;
+		return changed;
+	}
+	
+	if (crc_Ptr->s_pass == LCD_RENDER_EMIT)
+	{
+		for (loop=0;loop<LCD_CRC_SEGMENTS;loop++)
+		{
+			crc_Ptr->s_hash[loop] = crc_Ptr->s_work[loop];
+		}
+		crc_Ptr->s_flags |= LCD_CRC_VALID;
+		crc_Ptr->s_pass = LCD_RENDER_OFF;
+		LCD_endBatch();
+	}
+	return 0;
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_setDirectionInst
+[Description] : This function is responsible for setting the direction of the text: with LCD_DIRECTION_RTL the
+				characters of a string go from the cursor to the left, so a right-to-left text is written in its
+				logical order from the last column of its field without being reversed, and a number is written
+				with LCD_DIRECTION_LTR. The decrement or increment entry mode is sent before the next character only
+				if the controllers don't have it already, a display with a frame only moves its logical cursor.
+				LCD_DIRECTION_KEEP, the default, leaves the entry mode to the application
+				
+[Args] :
+[in] Lcd* a_lcd_Ptr, uint8 a_direction:
+a_lcd_Ptr: pointer to the display handle
+a_direction: LCD_DIRECTION_KEEP, LCD_DIRECTION_LTR or LCD_DIRECTION_RTL
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+void LCD_setDirectionInst(Lcd* a_lcd_Ptr, uint8 a_direction)
+{
+	a_lcd_Ptr->s_direction = a_direction;
+	if ((a_direction != LCD_DIRECTION_KEEP) && (a_lcd_Ptr->s_frame_Ptr == 0) &&
+		((a_lcd_Ptr->s_crc_Ptr == 0) || (a_lcd_Ptr->s_crc_Ptr->s_pass == LCD_RENDER_OFF)))
+	{
+		LCD_entrySync(a_lcd_Ptr, a_lcd_Ptr->s_direction);
+	}
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_displayCharacterInst
+[Description] : This function is responsible for sending character to the lcd, it call the LCD_write function which
+				takes two parameters, 1st the data to be sent to LCD, and the data type whether it's a data character 
+				or a command byte, so we call LCD_write and send LCD_XFER_DATA to indicate that it's a data not command.
+				In the right to left direction the text stops at column 0, written directly, in a frame or in a CRC
+				render the characters after the one of column 0 are dropped till the cursor is moved, instead of
+				going where the address counter of the controller leads
+				
+[Args] :
+[in] Lcd* a_lcd_Ptr, uint8 a_dataCharacter:
+a_lcd_Ptr: pointer to the display handle
+a_dataCharacter: The character to be displayed
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+void LCD_displayCharacterInst(Lcd* a_lcd_Ptr, uint8 a_dataCharacter)
+{
+	LcdFrame* frame_Ptr = a_lcd_Ptr->s_frame_Ptr;
+	uint8 ctrl;
+	uint8 row;
+	
+	if ((a_lcd_Ptr->s_crc_Ptr != 0) && (a_lcd_Ptr->s_crc_Ptr->s_pass != LCD_RENDER_OFF))
+	{
+		LCD_crcCharacter(a_lcd_Ptr, a_dataCharacter);
+		return;
+	}
+	if (frame_Ptr == 0)
+	{
+		if (a_lcd_Ptr->s_direction == LCD_DIRECTION_RTL)
+		{
+			if (a_lcd_Ptr->s_rtlEnd)
+			{
+				return;
+			}
+			/* the address counter leaves the line after its column 0, to the end of another visible line on a
+			*  20x4 display, so the text stops there as in a frame
+			*/
+			ctrl = a_lcd_Ptr->s_activeCtrl[a_lcd_Ptr->s_lane];
+			for (row=0;row<a_lcd_Ptr->s_lines;row++)
+			{
+				if ((a_lcd_Ptr->s_lineCtrl[row] == ctrl) &&
+					(a_lcd_Ptr->s_lineStart[row] == LCD_nextAddress(a_lcd_Ptr, ctrl)))
+				{
+					a_lcd_Ptr->s_rtlEnd = 1;
+				}
+			}
+		}
+		if (a_lcd_Ptr->s_direction != LCD_DIRECTION_KEEP)
+		{
+			LCD_entrySync(a_lcd_Ptr, a_lcd_Ptr->s_direction);
+		}
+		LCD_write(a_lcd_Ptr, a_dataCharacter, LCD_XFER_DATA);
+		return;
+	}
+	/* draw in the frame, characters out of the visible line are dropped */
+	if ((frame_Ptr->s_row < a_lcd_Ptr->s_lines) && (frame_Ptr->s_col < a_lcd_Ptr->s_length))
+	{
+		if (frame_Ptr->s_back[frame_Ptr->s_row][frame_Ptr->s_col] != a_dataCharacter)
+		{
+			frame_Ptr->s_back[frame_Ptr->s_row][frame_Ptr->s_col] = a_dataCharacter;
+			frame_Ptr->s_dirty |= (1 << frame_Ptr->s_row);
+		}
+		/* the frame is written with the increment entry mode, only its logical cursor goes to the left */
+		if (a_lcd_Ptr->s_direction == LCD_DIRECTION_RTL)
+		{
+			frame_Ptr->s_col = (frame_Ptr->s_col == 0) ? LCD_COL_PAST_START : (frame_Ptr->s_col - 1);
+		}
+		else
+		{
+			frame_Ptr->s_col++;
+		}
+	}
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_defineCharacterInst
+[Description] : This function is responsible for writing a custom character to the CGRAM of every controller of the
+				display, then the cursor of a display without frame goes back where it was so the next characters
+				are written to the DDRAM again. A character already shown changes on the display at once
+				
+[Args] :
+[in] Lcd* a_lcd_Ptr, uint8 a_code, const uint8* a_rows_Ptr:
+a_lcd_Ptr: pointer to the display handle
+a_code: the custom character [0-7], it is displayed with the code LCD_GLYPH_CODE + a_code
+a_rows_Ptr: LCD_GLYPH_ROWS rows of 5 dots from the top, bit 4 is the left dot
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+void LCD_defineCharacterInst(Lcd* a_lcd_Ptr, uint8 a_code, const uint8* a_rows_Ptr)
+{
+	uint8 ctrl;
+	uint8 row;
+	uint8 address;
+	
+	if (a_lcd_Ptr->s_frame_Ptr == 0)
+	{
+		/* the cursor goes back to the address counter after the queued writes */
+		LCD_flushInst(a_lcd_Ptr);
+	}
+	for (ctrl=0;ctrl<a_lcd_Ptr->s_controllers;ctrl++)
+	{
+		address = a_lcd_Ptr->s_ctrl[ctrl].s_mode.s_address;
+		LCD_enqueue(a_lcd_Ptr, ctrl, LCD_SET_CGRAM_ADDRESS | (uint8)((a_code & (LCD_GLYPHS - 1)) * LCD_GLYPH_ROWS),
+					LCD_XFER_CMD);
+		for (row=0;row<LCD_GLYPH_ROWS;row++)
+		{
+			LCD_enqueue(a_lcd_Ptr, ctrl, a_rows_Ptr[row] & 0x1F, LCD_XFER_DATA);
+		}
+		if ((a_lcd_Ptr->s_frame_Ptr == 0) && (address != LCD_ADDRESS_UNKNOWN))
+		{
+			LCD_enqueue(a_lcd_Ptr, ctrl, SET_CURSOR_LOCATION | address, LCD_XFER_CMD);
+		}
+	}
+	if (a_lcd_Ptr->s_frame_Ptr != 0)
+	{
+		/* the next frame cell is written with its address */
+		LCD_frameCursorLost(a_lcd_Ptr->s_frame_Ptr);
+	}
+	if (a_lcd_Ptr->s_crc_Ptr != 0)
+	{
+		a_lcd_Ptr->s_crc_Ptr->s_nextRow = LCD_ADDRESS_UNKNOWN;
+	}
+	if ((g_s_batch == 0) && (a_lcd_Ptr->s_frame_Ptr == 0))
+	{
+		LCD_flushInst(a_lcd_Ptr);
+	}
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_displayStringInst
+[Description] : This function is responsible for displaying string on the lcd, by displaying it character by character
+				till it reach the terminator character
+				
+[Args] :
+[in] Lcd* a_lcd_Ptr, const uint8 *a_dataString_Ptr:
+a_lcd_Ptr: pointer to the display handle
+a_dataString_Ptr is a pointer to character
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+void LCD_displayStringInst(Lcd* a_lcd_Ptr, const uint8 *a_dataString_Ptr)
+{
+	LCD_PROF_BEGIN();
+	
+	while(*a_dataString_Ptr != '\0')
+	{
+		/* Send character to LCD_displayCharacter function then post increment the pointer */
+		LCD_displayCharacterInst(a_lcd_Ptr, *a_dataString_Ptr++);
+	}
+	LCD_PROF_END(LCD_PROF_STRING);
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_displayNumberInst
+[Description] : This function is responsible for displaying integer numbers on the lcd by converting this integer 
+				to string using the itoa function and then display it as string, the value can be represented as
+				binary, decimal, octal, hexadecimal, or any other base from 2 to 35.
+				
+[Args] :
+[in] Lcd* a_lcd_Ptr, sint32 a_data, uint8 a_base:
+a_lcd_Ptr: pointer to the display handle
+a_data: The number value to be displayed on the LCD
+a_base: The number base to be displayed on the LCD 
+	Base can be any integer number from 2 to 35
+		2 represent binary,
+		8 represent octal,
+		10 represent decimal, 
+		16 represent hexadecimal, ..etc
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+void LCD_displayNumberInst(Lcd* a_lcd_Ptr, sint32 a_data, uint8 a_base)
+{
+	/* String to hold the ascii result, a negative number in base 2 is the longest */
+	uint8 buff[LCD_NUMBER_LENGTH];
+	LCD_PROF_BEGIN();
+	
+	/* Base can be 10 for decimal, 8 for octal, ..etc, can be from 2 to 35 */
+	itoaAnsiC(a_data,buff,a_base);
+	LCD_displayStringInst(a_lcd_Ptr, buff);
+	LCD_PROF_END(LCD_PROF_NUMBER);
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_formatNumber
+[Description] : This function is responsible for converting an integer number to the string displayed by
+				LCD_displayNumberInst, without writing it, so modules can pad or align it first
+				
+[Args] :
+[in] sint32 a_data, uint8 a_base:
+a_data: The number value to be converted
+a_base: The number base, any integer number from 2 to 35
+[out] uint8* a_str_Ptr:
+a_str_Ptr: buffer of LCD_NUMBER_LENGTH characters receiving the string, empty if the base is not valid
+[Returns] : The length of the string
+--------------------------------------------------------------------------------------------------------------- */
+uint8 LCD_formatNumber(sint32 a_data, uint8* a_str_Ptr, uint8 a_base)
+{
+	uint8 length = 0;
+	
+	itoaAnsiC(a_data,a_str_Ptr,a_base);
+	while (a_str_Ptr[length] != '\0')
+	{
+		length++;
+	}
+	return length;
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_displayFixedInst
+[Description] : This function is responsible for displaying a scaled integer as a decimal number with a fixed number
+				of fraction digits, 2345 with 2 fraction digits is "23.45" and -7 with 1 is "-0.7". The digits come
+				from subtracting the powers of ten, there is no float library, and the number is right aligned in
+				its field so the old digits are overwritten. More than LCD_FIXED_MAX_FRAC fraction digits are
+				rounded to LCD_FIXED_MAX_FRAC by the only division, 7 with 12 fraction digits is "0.000000000"
+				
+[Args] :
+[in] Lcd* a_lcd_Ptr, sint32 a_value, uint8 a_fracDigits, uint8 a_width:
+a_lcd_Ptr: pointer to the display handle
+a_value: the value multiplied by 10 to the power a_fracDigits
+a_fracDigits: digits after the decimal point, LCD_FIXED_MAX_FRAC are shown at most
+a_width: characters of the field padded with spaces on the left, 0 for no padding, a number wider than the
+		 field is shown as a_width LCD_NUMBER_OVERFLOW characters
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+void LCD_displayFixedInst(Lcd* a_lcd_Ptr, sint32 a_value, uint8 a_fracDigits, uint8 a_width)
+{
+	uint8 digits[LCD_NUMBER_LENGTH];
+	uint32 magnitude = (uint32)a_value;
+	uint32 power;
+	uint8 negative = (a_value < 0);
+	uint8 length;
+	uint8 integer;
+	uint8 size;
+	uint8 loop;
+	LCD_PROF_BEGIN();
+	
+	if (negative)
+	{
+		magnitude = (uint32)0 - magnitude;
+	}
+	if (a_fracDigits > LCD_FIXED_MAX_FRAC)
+	{
+		/* the extra digits are rounded off, from 10 of them even the largest magnitude rounds to 0 */
+		if ((a_fracDigits - LCD_FIXED_MAX_FRAC) > (sizeof(g_s_powersOfTen) / sizeof(g_s_powersOfTen[0])))
+		{
+			magnitude = 0;
+		}
+		else
+		{
+			power = FLASH_READ_DWORD(& g_s_powersOfTen[(sizeof(g_s_powersOfTen) / sizeof(g_s_powersOfTen[0])) -
+														(a_fracDigits - LCD_FIXED_MAX_FRAC)]);
+			magnitude = (magnitude + power / 2) / power;
+		}
+		a_fracDigits = LCD_FIXED_MAX_FRAC;
+		/* no "-0.000000000" */
+		negative = negative && (magnitude != 0);
+	}
+	length = LCD_decimal(magnitude, digits);
+	/* digits before the point, a 0 is shown before the point of a number below 1 */
+	integer = (length > a_fracDigits) ? (length - a_fracDigits) : 1;
+	size = integer + a_fracDigits + (a_fracDigits != 0) + negative;
+	
+	if ((a_width != 0) && (size > a_width))
+	{
+		for (loop=0;loop<a_width;loop++)
+		{
+			LCD_displayCharacterInst(a_lcd_Ptr, LCD_NUMBER_OVERFLOW);
+		}
+		LCD_PROF_END(LCD_PROF_NUMBER);
+		return;
+	}
+	for (loop=size;loop<a_width;loop++)
+	{
+		LCD_displayCharacterInst(a_lcd_Ptr, ' ');
+	}
+	if (negative)
+	{
+		LCD_displayCharacterInst(a_lcd_Ptr, '-');
+	}
+	if (length > a_fracDigits)
+	{
+		for (loop=0;loop<integer;loop++)
+		{
+			LCD_displayCharacterInst(a_lcd_Ptr, digits[loop]);
+		}
+	}
+	else
+	{
+		LCD_displayCharacterInst(a_lcd_Ptr, '0');
+	}
+	if (a_fracDigits != 0)
+	{
+		LCD_displayCharacterInst(a_lcd_Ptr, '.');
+		/* the zeros after the point of a number below 0.1 */
+		for (loop=length;loop<a_fracDigits;loop++)
+		{
+			LCD_displayCharacterInst(a_lcd_Ptr, '0');
+		}
+		for (loop=(length > a_fracDigits) ? integer : 0;loop<length;loop++)
+		{
+			LCD_displayCharacterInst(a_lcd_Ptr, digits[loop]);
+		}
+	}
+	LCD_PROF_END(LCD_PROF_NUMBER);
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_displayFloatInst
+[Description] : This function is responsible for displaying a float with a fixed number of fraction digits, it is
+				rounded to a scaled integer and displayed by LCD_displayFixedInst, so only a float multiplication is
+				linked instead of the float printf or dtostrf. More than LCD_FIXED_MAX_FRAC fraction digits are
+				rounded to LCD_FIXED_MAX_FRAC
+				
+[Args] :
+[in] Lcd* a_lcd_Ptr, float a_value, uint8 a_fracDigits, uint8 a_width:
+a_lcd_Ptr: pointer to the display handle
+a_value: the value, its scaled value must be within a sint32 else the field shows LCD_NUMBER_OVERFLOW, a
+		 single one without a field
+a_fracDigits: digits after the decimal point, LCD_FIXED_MAX_FRAC are shown at most
+a_width: characters of the field padded with spaces on the left, 0 for no padding
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+void LCD_displayFloatInst(Lcd* a_lcd_Ptr, float a_value, uint8 a_fracDigits, uint8 a_width)
+{
+	uint8 loop;
+	
+	if (a_fracDigits > LCD_FIXED_MAX_FRAC)
+	{
+		a_fracDigits = LCD_FIXED_MAX_FRAC;
+	}
+	for (loop=0;loop<a_fracDigits;loop++)
+	{
+		a_value *= 10.0f;
+	}
+	/* the largest float below 2^31, a NaN fails both comparisons */
+	if (!((a_value < 2147483520.0f) && (a_value > -2147483520.0f)))
+	{
+		/* without a field the overflow is still shown, by one character */
+		if (a_width == 0)
+		{
+			a_width = 1;
+		}
+		for (loop=0;loop<a_width;loop++)
+		{
+			LCD_displayCharacterInst(a_lcd_Ptr, LCD_NUMBER_OVERFLOW);
+		}
+		return;
+	}
+	LCD_displayFixedInst(a_lcd_Ptr, (sint32)((a_value < 0.0f) ? (a_value - 0.5f) : (a_value + 0.5f)), a_fracDigits,
+						 a_width);
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_goToRowColumnInst
+[Description] : This function is responsible for moving the cursor to a specific row and column on the lcd screen
+				
+[Args] :
+[in] Lcd* a_lcd_Ptr, uint8 a_row,uint8 a_col:
+a_lcd_Ptr: pointer to the display handle
+uint8 a_row, the row number
+uint8 a_col, the column number
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+void LCD_goToRowColumnInst(Lcd* a_lcd_Ptr, uint8 a_row,uint8 a_col)
+{
+	LCD_PROF_BEGIN();
+	
+	/* rows out of the display go to the first line */
+	if (a_row >= a_lcd_Ptr->s_lines)
+	{
+		a_row = 0;
+	}
+	if (a_lcd_Ptr->s_frame_Ptr != 0)
+	{
+		/* only the cursor of the frame moves */
+		a_lcd_Ptr->s_frame_Ptr->s_row = a_row;
+		a_lcd_Ptr->s_frame_Ptr->s_col = a_col;
+	}
+	else if ((a_lcd_Ptr->s_crc_Ptr != 0) && (a_lcd_Ptr->s_crc_Ptr->s_pass != LCD_RENDER_OFF))
+	{
+		/* the cursor is moved when a character of a changed span is sent */
+		a_lcd_Ptr->s_crc_Ptr->s_row = a_row;
+		a_lcd_Ptr->s_crc_Ptr->s_col = a_col;
+	}
+	else
+	{
+		LCD_goToAddress(a_lcd_Ptr, a_row, a_col);
+	}
+	LCD_PROF_END(LCD_PROF_GOTO);
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_goToAddress
+[Description] : This function is responsible for queuing the cursor location command of a row and column, and 
+				making the controller of this line the active one of the current lane
+				
+[Args] :
+[in] Lcd* a_lcd_Ptr, uint8 a_row,uint8 a_col:
+a_lcd_Ptr: pointer to the display handle
+a_row: the row number, it must be less than the number of lines
+a_col: the column number
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+static void LCD_goToAddress(Lcd* a_lcd_Ptr, uint8 a_row, uint8 a_col)
+{
+	/* local variable to hold the LCD address value for the cursor */
+	uint8 address;
+	
+	/* first of all calculate the required address */
+	address = a_col + a_lcd_Ptr->s_lineStart[a_row];
+	/* the next characters of this lane go to the controller which drives this line */
+	a_lcd_Ptr->s_activeCtrl[a_lcd_Ptr->s_lane] = a_lcd_Ptr->s_lineCtrl[a_row];
+	
+	/* to write to a specific address in the LCD 
+	 * we need to apply the corresponding command 0b10000000+address 
+	*/
+	LCD_write(a_lcd_Ptr, address|SET_CURSOR_LOCATION, LCD_XFER_CMD); 
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_displayStringRowColumnInst
+[Description] : This function is responsible for moving the cursor to a specific row and column on the lcd screen
+				and display a string from this position
+				
+[Args] :
+[in] Lcd* a_lcd_Ptr, uint8 a_row,uint8 a_col,const char *a_str_Ptr:
+a_lcd_Ptr: pointer to the display handle
+uint8 a_row, the row number
+uint8 a_col, the column number
+const char *a_str_Ptr, pointer to the sting to be displayed character by charater using displayCharacter function 
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+void LCD_displayStringRowColumnInst(Lcd* a_lcd_Ptr, uint8 a_row, uint8 a_col, const uint8 *a_str_Ptr)
+{
+	/* go to to the required LCD position */
+	LCD_goToRowColumnInst(a_lcd_Ptr, a_row, a_col);
+	/* display the string */
+	LCD_displayStringInst(a_lcd_Ptr, a_str_Ptr);
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_displayStringRowColumnRtlInst
+[Description] : This function is responsible for displaying a right-to-left string in its logical order, its first
+				character at a position and the next ones on its left, the display stays in LCD_DIRECTION_RTL
+				
+[Args] :
+[in] Lcd* a_lcd_Ptr, uint8 a_row, uint8 a_col, const uint8 *a_str_Ptr:
+a_lcd_Ptr: pointer to the display handle
+a_row, a_col: position of the first character, the last column of the field
+a_str_Ptr: pointer to the string
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+void LCD_displayStringRowColumnRtlInst(Lcd* a_lcd_Ptr, uint8 a_row, uint8 a_col, const uint8 *a_str_Ptr)
+{
+	LCD_setDirectionInst(a_lcd_Ptr, LCD_DIRECTION_RTL);
+	LCD_displayStringRowColumnInst(a_lcd_Ptr, a_row, a_col, a_str_Ptr);
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_displayStringRowColumnLtrInst
+[Description] : This function is responsible for displaying a left-to-right string, a number in a right-to-left
+				screen for example, the display stays in LCD_DIRECTION_LTR
+				
+[Args] :
+[in] Lcd* a_lcd_Ptr, uint8 a_row, uint8 a_col, const uint8 *a_str_Ptr:
+a_lcd_Ptr: pointer to the display handle
+a_row, a_col: position of the first character
+a_str_Ptr: pointer to the string
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+void LCD_displayStringRowColumnLtrInst(Lcd* a_lcd_Ptr, uint8 a_row, uint8 a_col, const uint8 *a_str_Ptr)
+{
+	LCD_setDirectionInst(a_lcd_Ptr, LCD_DIRECTION_LTR);
+	LCD_displayStringRowColumnInst(a_lcd_Ptr, a_row, a_col, a_str_Ptr);
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_writeBus
+[Description] : This function is responsible for putting one nibble (4-bit mode) or one byte (8-bit mode) on the 
+				data pins of a display without toggling the enable pin, so the same prepared value can be read by
+				one or more displays sharing the bus
+				
+[Args] :
+[in] Lcd* a_lcd_Ptr, uint8 a_value:
+a_lcd_Ptr: pointer to the display handle which its data pins are used
+a_value: the nibble or byte to be put on the data pins, bit 0 goes to s_data[0]
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+static void LCD_writeBus(Lcd* a_lcd_Ptr, uint8 a_value)
+{
+	uint8 loop;
+	for (loop=0;loop<LCD_IO_MODE;loop++)
+	{
+		/*	write each bit in the value on each corresponding pin
+		*	shift the value from [0-7] and AND it with 1 to get only the bit value 
+		*	then write this bit to data bin
+		*/
+		a_lcd_Ptr->s_data[loop].s_value = ((a_value >> loop) & 1);
+		DIO_writePin(& a_lcd_Ptr->s_data[loop]);
+	}
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_write
+[Description] : This function is responsible for write on LCD, it queues the data or command to the controller which
+				should receive it, data characters and cursor location go to the active controller and the other
+				commands go to all the controllers of the display, then it sends the queued writes if no batch is
+				started
+				
+[Args] :
+[in] Lcd* a_lcd_Ptr, uint8 a_data, uint8 a_dataType:
+a_lcd_Ptr: pointer to the display handle
+a_data: The data to be sent to LCD
+a_dataType: the data type whether its a command or data
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+static void LCD_write (Lcd* a_lcd_Ptr, uint8 a_data, uint8 a_dataType)
+{	
+	uint8 ctrl;
+	LCD_PROF_BEGIN();
+	
+	if ((a_lcd_Ptr->s_frame_Ptr != 0) && (a_dataType == LCD_XFER_CMD) && (a_data == LCD_CLR))
+	{
+		/* the display and the frame are empty, the changes drawn before are dropped */
+		LCD_frameFill(a_lcd_Ptr->s_frame_Ptr, 1);
+		a_lcd_Ptr->s_frame_Ptr->s_dirty = 0;
+	}
+	if ((a_lcd_Ptr->s_crc_Ptr != 0) && (a_lcd_Ptr->s_crc_Ptr->s_pass == LCD_RENDER_OFF))
+	{
+		/* written outside a render, the span CRCs don't match the display anymore */
+		if ((a_dataType == LCD_XFER_DATA) || (a_data == LCD_CLR))
+		{
+			a_lcd_Ptr->s_crc_Ptr->s_flags &= ~LCD_CRC_VALID;
+		}
+		a_lcd_Ptr->s_crc_Ptr->s_nextRow = LCD_ADDRESS_UNKNOWN;
+	}
+	
+	if (a_dataType == LCD_XFER_CMD)
+	{
+		/* a right to left text which passed column 0 goes on from the new cursor */
+		if ((a_data & SET_CURSOR_LOCATION) || (a_data == LCD_CLR) || ((a_data & 0xFE) == 0x02))
+		{
+			a_lcd_Ptr->s_rtlEnd = 0;
+		}
+		/* the entry mode after the queued writes, a clear sets the increment */
+		if ((a_data & 0xFC) == LCD_ENTRY_DEC)
+		{
+			a_lcd_Ptr->s_entryMode = a_data;
+		}
+		else if ((a_data == LCD_CLR) && (a_lcd_Ptr->s_entryMode != LCD_ADDRESS_UNKNOWN))
+		{
+			a_lcd_Ptr->s_entryMode |= (LCD_ENTRY_INC ^ LCD_ENTRY_DEC);
+		}
+	}
+	
+	if ((a_dataType == LCD_XFER_DATA) || (a_data & SET_CURSOR_LOCATION))
+	{
+		/* data characters and cursor location are for the active controller only */
+		LCD_enqueue(a_lcd_Ptr, a_lcd_Ptr->s_activeCtrl[a_lcd_Ptr->s_lane], a_data, a_dataType);
+	}
+	else
+	{
+		/* clear, display control, entry mode, .. are for all the controllers of the display */
+		for (ctrl=0;ctrl<a_lcd_Ptr->s_controllers;ctrl++)
+		{
+			LCD_enqueue(a_lcd_Ptr, ctrl, a_data, a_dataType);
+		}
+	}
+	
+	/* the writes of a display with a frame are sent by LCD_service or LCD_flushInst */
+	if ((g_s_batch == 0) && (a_lcd_Ptr->s_frame_Ptr == 0))
+	{
+		LCD_flushInst(a_lcd_Ptr);
+	}
+	LCD_PROF_END(LCD_PROF_WRITE);
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_enqueue
+[Description] : This function is responsible for adding one write to the queue of the current lane of a controller,
+				if the queue is full the scheduler sends writes till there is a free place
+				
+[Args] :
+[in] Lcd* a_lcd_Ptr, uint8 a_ctrl, uint8 a_data, uint8 a_dataType:
+a_lcd_Ptr: pointer to the display handle
+a_ctrl: index of the controller
+a_data: The data to be sent to LCD
+a_dataType: LCD_XFER_CMD or LCD_XFER_DATA
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+static void LCD_enqueue(Lcd* a_lcd_Ptr, uint8 a_ctrl, uint8 a_data, uint8 a_dataType)
+{
+	LcdController* ctrl_Ptr = & a_lcd_Ptr->s_ctrl[a_ctrl];
+	LcdLane* lane_Ptr = & ctrl_Ptr->s_lane[a_lcd_Ptr->s_lane];
+	uint8 depth = (a_lcd_Ptr->s_lane == LCD_LANE_URGENT) ? LCD_URGENT_DEPTH : LCD_PENDING_DEPTH;
+	LcdXfer* xfer_Ptr;
+	
+	if ((ctrl_Ptr->s_lane[LCD_LANE_BACKGROUND].s_count == 0) && (ctrl_Ptr->s_lane[LCD_LANE_URGENT].s_count == 0))
+	{
+		/* nothing is queued, the state after the queue is the controller state, but the next data character
+		*  of the lane goes where the lane stopped if the other lane moved the cursor
+		*/
+		ctrl_Ptr->s_tail = ctrl_Ptr->s_mode;
+		ctrl_Ptr->s_tailUndo = LCD_ADDRESS_UNKNOWN;
+		if ((lane_Ptr->s_address != LCD_ADDRESS_UNKNOWN) && (lane_Ptr->s_address != ctrl_Ptr->s_mode.s_address))
+		{
+			ctrl_Ptr->s_tail.s_address = LCD_ADDRESS_UNKNOWN;
+		}
+	}
+	if (ctrl_Ptr->s_lane[a_lcd_Ptr->s_lane ^ 1].s_count == 0)
+	{
+	#if (LCD_PEEPHOLE == 1)
+		if (LCD_peephole(a_lcd_Ptr, a_ctrl, & a_data, & a_dataType))
+		{
+			if (lane_Ptr->s_count == 0)
+			{
+				/* as if the dropped write was sent, the lane goes on from the controller cursor */
+				lane_Ptr->s_address = ctrl_Ptr->s_mode.s_address;
+			}
+			return;
+		}
+	#endif
+	}
+	else
+	{
+		/* the scheduler mixes the writes of the two lanes, the state after the queue is not known till it is empty */
+		ctrl_Ptr->s_tail.s_address		= LCD_ADDRESS_UNKNOWN;
+		ctrl_Ptr->s_tail.s_entryMode	= LCD_ADDRESS_UNKNOWN;
+		ctrl_Ptr->s_tail.s_dispCtrl		= LCD_ADDRESS_UNKNOWN;
+		ctrl_Ptr->s_tail.s_writtenLo	= LCD_ADDRESS_UNKNOWN;
+		ctrl_Ptr->s_tailUndo			= LCD_ADDRESS_UNKNOWN;
+	}
+	
+	while (lane_Ptr->s_count == depth)
+	{
+		LCD_scheduleStep();
+	}
+	xfer_Ptr = LCD_laneXfer(ctrl_Ptr, a_lcd_Ptr->s_lane, lane_Ptr->s_count);
+	xfer_Ptr->s_data = a_data;
+	xfer_Ptr->s_type = a_dataType;
+	lane_Ptr->s_count++;
+	LCD_follow(& ctrl_Ptr->s_tail, a_data, a_dataType);
+}
+
+#if (LCD_PEEPHOLE == 1)
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_peephole
+[Description] : This function is responsible for optimizing a write before it is queued, the other lane of the
+				controller must be empty so the queued writes are sent in their order:
+				1. it replaces the last queued write if both are cursor locations, display controls or entry modes,
+				   and both are dropped if the new one sets back the state before the queued one (display off
+				   then on for example)
+				2. a cursor location where the cursor already is after the queued writes is dropped
+				3. a display control or entry mode which the controller already has is dropped, a clear is dropped
+				   if nothing is written since the last one and the cursor is at home, and a space on a cell blank
+				   since the last clear is changed to a cursor location command, so a run of spaces is one command.
+				   Urgent writes queued later are sent before the background ones and may change this state, so
+				   these are only done for the urgent lane, or if the write is sent now (no batch and no frame)
+				
+[Args] :
+[in] Lcd* a_lcd_Ptr, uint8 a_ctrl:
+a_lcd_Ptr: pointer to the display handle
+a_ctrl: index of the controller
+[in/out] uint8* a_data_Ptr, uint8* a_dataType_Ptr:
+a_data_Ptr, a_dataType_Ptr: the write, a space on a blank cell is changed to a cursor location command
+[Returns] : This function return 1 if nothing has to be queued or 0 if the write has to be queued
+--------------------------------------------------------------------------------------------------------------- */
+static uint8 LCD_peephole(Lcd* a_lcd_Ptr, uint8 a_ctrl, uint8* a_data_Ptr, uint8* a_dataType_Ptr)
+{
+	LcdController* ctrl_Ptr = & a_lcd_Ptr->s_ctrl[a_ctrl];
+	LcdMode* tail_Ptr = & ctrl_Ptr->s_tail;
+	LcdLane* lane_Ptr = & ctrl_Ptr->s_lane[a_lcd_Ptr->s_lane];
+	LcdXfer* last_Ptr;
+	uint8 data = *a_data_Ptr;
+	uint8 address = tail_Ptr->s_address;
+	uint8 stable;
+	uint8 kind;
+	uint8 current;
+	
+	/* the state after the queued writes is not changed by urgent writes before this one is sent */
+	stable = (a_lcd_Ptr->s_lane == LCD_LANE_URGENT) || ((g_s_batch == 0) && (a_lcd_Ptr->s_frame_Ptr == 0));
+	
+	if (*a_dataType_Ptr == LCD_XFER_DATA)
+	{
+		/* the cursor location after the space, which must not pass the end of a line in the DDRAM */
+		if ((data != ' ') || (stable == 0) || (address == LCD_ADDRESS_UNKNOWN) ||
+			(tail_Ptr->s_writtenLo == LCD_ADDRESS_UNKNOWN) ||
+			((address >= tail_Ptr->s_writtenLo) && (address <= tail_Ptr->s_writtenHi)) ||
+			(tail_Ptr->s_entryMode == LCD_ADDRESS_UNKNOWN) || (tail_Ptr->s_entryMode & LCD_ENTRY_SHIFT_BIT))
+		{
+			ctrl_Ptr->s_tailUndo = LCD_ADDRESS_UNKNOWN;
+			return 0;
+		}
+		if ((tail_Ptr->s_entryMode & (LCD_ENTRY_INC ^ LCD_ENTRY_DEC)) && ((address & 0x3F) < LCD_PROBE_ADDRESS))
+		{
+			address++;
+		}
+		else if (((tail_Ptr->s_entryMode & (LCD_ENTRY_INC ^ LCD_ENTRY_DEC)) == 0) && ((address & 0x3F) != 0))
+		{
+			address--;
+		}
+		else
+		{
+			ctrl_Ptr->s_tailUndo = LCD_ADDRESS_UNKNOWN;
+			return 0;
+		}
+		data = SET_CURSOR_LOCATION | address;
+		*a_data_Ptr = data;
+		*a_dataType_Ptr = LCD_XFER_CMD;
+	}
+	else if (data == LCD_CLR)
+	{
+		if (stable && (tail_Ptr->s_writtenLo != LCD_ADDRESS_UNKNOWN) && (tail_Ptr->s_writtenLo > tail_Ptr->s_writtenHi) &&
+			(tail_Ptr->s_address == 0) && (tail_Ptr->s_entryMode != LCD_ADDRESS_UNKNOWN) &&
+			(tail_Ptr->s_entryMode & (LCD_ENTRY_INC ^ LCD_ENTRY_DEC)))
+		{
+			a_lcd_Ptr->s_stats.s_peepholeDrops++;
+			return 1;
+		}
+		ctrl_Ptr->s_tailUndo = LCD_ADDRESS_UNKNOWN;
+		return 0;
+	}
+	
+	kind = LCD_peepKind(data);
+	if (kind == SET_CURSOR_LOCATION)
+	{
+		/* the scheduler moves the cursor back for the data characters of each lane, it is always known */
+		current = (tail_Ptr->s_address == LCD_ADDRESS_UNKNOWN) ? LCD_ADDRESS_UNKNOWN :
+				  (SET_CURSOR_LOCATION | tail_Ptr->s_address);
+	}
+	else if (kind == LCD_DISP_OFF)
+	{
+		current = stable ? tail_Ptr->s_dispCtrl : LCD_ADDRESS_UNKNOWN;
+	}
+	else if (kind == LCD_ENTRY_DEC)
+	{
+		current = stable ? tail_Ptr->s_entryMode : LCD_ADDRESS_UNKNOWN;
+	}
+	else
+	{
+		ctrl_Ptr->s_tailUndo = LCD_ADDRESS_UNKNOWN;
+		return 0;
+	}
+	
+	if ((current != LCD_ADDRESS_UNKNOWN) && (data == current))
+	{
+		/* the controller is already in this state after the queued writes */
+		a_lcd_Ptr->s_stats.s_peepholeDrops++;
+		return 1;
+	}
+	if (lane_Ptr->s_count != 0)
+	{
+		last_Ptr = LCD_laneXfer(ctrl_Ptr, a_lcd_Ptr->s_lane, lane_Ptr->s_count - 1);
+		if ((last_Ptr->s_type == LCD_XFER_CMD) && (LCD_peepKind(last_Ptr->s_data) == kind))
+		{
+			if (data == ctrl_Ptr->s_tailUndo)
+			{
+				/* the queued write and this one cancel out */
+				lane_Ptr->s_count--;
+				ctrl_Ptr->s_tailUndo = LCD_ADDRESS_UNKNOWN;
+				a_lcd_Ptr->s_stats.s_peepholeDrops += 2;
+			}
+			else
+			{
+				/* the queued write is not sent yet, only the last one matters */
+				last_Ptr->s_data = data;
+				a_lcd_Ptr->s_stats.s_peepholeDrops++;
+			}
+			LCD_follow(tail_Ptr, data, LCD_XFER_CMD);
+			return 1;
+		}
+	}
+	ctrl_Ptr->s_tailUndo = current;
+	return 0;
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_peepKind
+[Description] : This function is responsible for returning the kind of a command for the peephole optimizer, the
+				commands of these kinds only set a state which the next command of the same kind replaces
+				
+[Args] :
+[in] uint8 a_command:
+a_command: the command
+[Returns] : SET_CURSOR_LOCATION, LCD_DISP_OFF (display control), LCD_ENTRY_DEC (entry mode) or 0 for the others
+--------------------------------------------------------------------------------------------------------------- */
+static uint8 LCD_peepKind(uint8 a_command)
+{
+	if (a_command & SET_CURSOR_LOCATION)
+	{
+		return SET_CURSOR_LOCATION;
+	}
+	if ((a_command & 0xF8) == LCD_DISP_OFF)
+	{
+		return LCD_DISP_OFF;
+	}
+	if ((a_command & 0xFC) == LCD_ENTRY_DEC)
+	{
+		return LCD_ENTRY_DEC;
+	}
+	return 0;
+}
+#endif
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_scheduleStep
+[Description] : This function is responsible for sending one queued write, it goes through the controllers of all
+				displays and picks the one which has urgent queued writes, or background ones if no controller has
+				urgent writes, and has the nearest busy deadline. If the oldest write of the lane is a data
+				character and the other lane has moved the cursor, the cursor is moved back first
+				
+[Args] :
+[in] void:
+[Returns] : This function return 1 if a write is sent or 0 if all the queues are empty
+--------------------------------------------------------------------------------------------------------------- */
+static uint8 LCD_scheduleStep(void)
+{
+	Lcd* bestLcd_Ptr;
+	uint8 bestCtrl;
+	uint8 bestLane;
+	sint16 bestWait;
+	LcdController* ctrl_Ptr;
+	LcdLane* lane_Ptr;
+	LcdXfer* xfer_Ptr;
+	
+	/* a character boundary, let the application queue its urgent writes */
+	if ((g_s_preemptHook != 0) && (g_s_inHook == 0))
+	{
+		g_s_inHook = 1;
+		g_s_batch++;
+		g_s_preemptHook();
+		g_s_batch--;
+		g_s_inHook = 0;
+	}
+	
+	if (LCD_schedulePick(& bestLcd_Ptr, & bestCtrl, & bestLane, & bestWait) == 0)
+	{
+		return 0;
+	}
+	
+	ctrl_Ptr = & bestLcd_Ptr->s_ctrl[bestCtrl];
+	lane_Ptr = & ctrl_Ptr->s_lane[bestLane];
+	xfer_Ptr = LCD_laneXfer(ctrl_Ptr, bestLane, 0);
+	
+	if ((xfer_Ptr->s_type == LCD_XFER_DATA) && (lane_Ptr->s_address != LCD_ADDRESS_UNKNOWN) &&
+		(lane_Ptr->s_address != ctrl_Ptr->s_mode.s_address))
+	{
+		/* the other lane moved the cursor, move it back to where this lane stopped */
+		LCD_transfer(bestLcd_Ptr, bestCtrl, SET_CURSOR_LOCATION | lane_Ptr->s_address, LCD_XFER_CMD);
+		return 1;
+	}
+	
+	/* send the oldest write of this lane, its cursor is now where the controller cursor is */
+	LCD_transfer(bestLcd_Ptr, bestCtrl, xfer_Ptr->s_data, xfer_Ptr->s_type);
+	lane_Ptr->s_address = ctrl_Ptr->s_mode.s_address;
+	lane_Ptr->s_head = (uint8)(lane_Ptr->s_head + 1) % ((bestLane == LCD_LANE_URGENT) ? LCD_URGENT_DEPTH : LCD_PENDING_DEPTH);
+	lane_Ptr->s_count--;
+	return 1;
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_schedulePick
+[Description] : This function is responsible for finding the controller which the scheduler sends to next, it has
+				urgent queued writes, or background ones if no controller has urgent writes, and the nearest busy
+				deadline
+				
+[Args] :
+[out] Lcd** a_lcd_PPtr, uint8* a_ctrl_Ptr, uint8* a_lane_Ptr, sint16* a_wait_Ptr:
+a_lcd_PPtr: the display of the picked controller
+a_ctrl_Ptr: index of the picked controller
+a_lane_Ptr: lane of the write to be sent
+a_wait_Ptr: time in micro seconds till the controller is not busy
+[Returns] : This function return 1 if a controller is picked or 0 if all the queues are empty
+--------------------------------------------------------------------------------------------------------------- */
+static uint8 LCD_schedulePick(Lcd** a_lcd_PPtr, uint8* a_ctrl_Ptr, uint8* a_lane_Ptr, sint16* a_wait_Ptr)
+{
+	Lcd* lcd_Ptr;
+	Lcd* bestLcd_Ptr = 0;
+	uint8 ctrl;
+	uint8 lane;
+	uint8 bestCtrl = 0;
+	uint8 bestLane = LCD_LANE_BACKGROUND;
+	sint16 wait;
+	sint16 bestWait = 0;
+	
+	/* find the controller with queued writes of the highest lane which is free the soonest */
+	for (lcd_Ptr=g_s_lcdList; lcd_Ptr != 0; lcd_Ptr=lcd_Ptr->s_next)
+	{
+		for (ctrl=0;ctrl<lcd_Ptr->s_controllers;ctrl++)
+		{
+			for (lane=LCD_LANE_BACKGROUND;lane<LCD_LANES;lane++)
+			{
+				if (lcd_Ptr->s_ctrl[ctrl].s_lane[lane].s_count != 0)
+				{
+					wait = (sint16)(lcd_Ptr->s_ctrl[ctrl].s_deadline - g_s_busClock);
+					/* deadlines older than the longest execution time are reached already */
+					if ((wait < 0) || (wait > LCD_EXEC_CLEAR_US))
+					{
+						wait = 0;
+					}
+					if ((bestLcd_Ptr == 0) || (lane > bestLane) || ((lane == bestLane) && (wait < bestWait)))
+					{
+						bestLcd_Ptr	= lcd_Ptr;
+						bestCtrl	= ctrl;
+						bestLane	= lane;
+						bestWait	= wait;
+					}
+				}
+			}
+		}
+	}
+	
+	*a_lcd_PPtr		= bestLcd_Ptr;
+	*a_ctrl_Ptr		= bestCtrl;
+	*a_lane_Ptr		= bestLane;
+	*a_wait_Ptr		= bestWait;
+	return (bestLcd_Ptr != 0);
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_transfer
+[Description] : This function is responsible for sending one write to a controller when it is not busy anymore, then
+				calculating its new busy deadline and following its address counter and entry mode
+				
+[Args] :
+[in] Lcd* a_lcd_Ptr, uint8 a_ctrl, uint8 a_data, uint8 a_dataType:
+a_lcd_Ptr: pointer to the display handle
+a_ctrl: index of the controller
+a_data: The data to be sent to LCD
+a_dataType: LCD_XFER_CMD or LCD_XFER_DATA
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+static void LCD_transfer(Lcd* a_lcd_Ptr, uint8 a_ctrl, uint8 a_data, uint8 a_dataType)
+{
+	LcdController* ctrl_Ptr = & a_lcd_Ptr->s_ctrl[a_ctrl];
+	
+	LCD_waitDeadline(ctrl_Ptr->s_deadline);
+	LCD_busWrite(a_lcd_Ptr, a_ctrl, a_data, a_dataType);
+	ctrl_Ptr->s_deadline = g_s_busClock + LCD_execTime(a_data, a_dataType);
+	LCD_follow(& ctrl_Ptr->s_mode, a_data, a_dataType);
+	if (a_dataType == LCD_XFER_DATA)
+	{
+		a_lcd_Ptr->s_stats.s_dataWrites++;
+	}
+	else
+	{
+		a_lcd_Ptr->s_stats.s_cmdWrites++;
+	}
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_follow
+[Description] : This function is responsible for updating the state of a controller after a write, the address is
+				LCD_ADDRESS_UNKNOWN after writing the CGRAM address or shifting the cursor, and the DDRAM is not
+				known blank anymore after a data byte written where the address is not known or a display shift
+				
+[Args] :
+[in] LcdMode* a_mode_Ptr, uint8 a_data, uint8 a_dataType:
+a_mode_Ptr: pointer to the state of the controller, or the state after its queued writes
+a_data: The data or command written
+a_dataType: LCD_XFER_CMD or LCD_XFER_DATA
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+static void LCD_follow(LcdMode* a_mode_Ptr, uint8 a_data, uint8 a_dataType)
+{
+	if (a_dataType == LCD_XFER_DATA)
+	{
+		if ((a_mode_Ptr->s_address == LCD_ADDRESS_UNKNOWN) || (a_mode_Ptr->s_entryMode & LCD_ENTRY_SHIFT_BIT))
+		{
+			a_mode_Ptr->s_writtenLo = LCD_ADDRESS_UNKNOWN;
+		}
+		else if (a_mode_Ptr->s_writtenLo != LCD_ADDRESS_UNKNOWN)
+		{
+			/* the cells written since the last clear */
+			if (a_mode_Ptr->s_address < a_mode_Ptr->s_writtenLo)
+			{
+				a_mode_Ptr->s_writtenLo = a_mode_Ptr->s_address;
+			}
+			if (a_mode_Ptr->s_address > a_mode_Ptr->s_writtenHi)
+			{
+				a_mode_Ptr->s_writtenHi = a_mode_Ptr->s_address;
+			}
+		}
+		/* the address counter moves one place in the entry mode direction, where it goes from the end of a line
+		*  depends on the number of lines of the function set, it is not followed
+		*/
+		if ((a_mode_Ptr->s_entryMode == LCD_ADDRESS_UNKNOWN) ||
+			((a_mode_Ptr->s_entryMode & (LCD_ENTRY_INC ^ LCD_ENTRY_DEC)) &&
+			 ((a_mode_Ptr->s_address == LCD_PROBE_ADDRESS) || (a_mode_Ptr->s_address == 0x4F) ||
+			  (a_mode_Ptr->s_address == (LCD_PROBE_ADDRESS | 0x40)))) ||
+			(((a_mode_Ptr->s_entryMode & (LCD_ENTRY_INC ^ LCD_ENTRY_DEC)) == 0) &&
+			 ((a_mode_Ptr->s_address & 0x3F) == 0)))
+		{
+			a_mode_Ptr->s_address = LCD_ADDRESS_UNKNOWN;
+		}
+		else if (a_mode_Ptr->s_address != LCD_ADDRESS_UNKNOWN)
+		{
+			if (a_mode_Ptr->s_entryMode & (LCD_ENTRY_INC ^ LCD_ENTRY_DEC))
+			{
+				a_mode_Ptr->s_address = (a_mode_Ptr->s_address + 1) & 0x7F;
+			}
+			else
+			{
+				a_mode_Ptr->s_address = (a_mode_Ptr->s_address - 1) & 0x7F;
+			}
+		}
+	}
+	else if (a_data & SET_CURSOR_LOCATION)
+	{
+		a_mode_Ptr->s_address = a_data & (uint8)~SET_CURSOR_LOCATION;
+	}
+	else if (a_data & 0x40)
+	{
+		/* set CGRAM address, the next data characters don't go to the DDRAM */
+		a_mode_Ptr->s_address = LCD_ADDRESS_UNKNOWN;
+	}
+	else if ((a_data & 0xF0) == 0x10)
+	{
+		/* cursor or display shift, only a clear brings the shifted display back */
+		a_mode_Ptr->s_address = LCD_ADDRESS_UNKNOWN;
+		if (a_data & 0x08)
+		{
+			a_mode_Ptr->s_writtenLo = LCD_ADDRESS_UNKNOWN;
+		}
+	}
+	else if ((a_data & 0xF8) == LCD_DISP_OFF)
+	{
+		a_mode_Ptr->s_dispCtrl = a_data;
+	}
+	else if ((a_data & 0xFC) == LCD_ENTRY_DEC)
+	{
+		a_mode_Ptr->s_entryMode = a_data;
+	}
+	else if ((a_data == LCD_CLR) || ((a_data & 0xFE) == 0x02))
+	{
+		/* clear display and return home, clear also sets the increment entry mode */
+		a_mode_Ptr->s_address = 0;
+		if (a_data == LCD_CLR)
+		{
+			if (a_mode_Ptr->s_entryMode != LCD_ADDRESS_UNKNOWN)
+			{
+				a_mode_Ptr->s_entryMode |= (LCD_ENTRY_INC ^ LCD_ENTRY_DEC);
+			}
+			/* no cell is written, the low limit is after the high one */
+			a_mode_Ptr->s_writtenLo = 0x7F;
+			a_mode_Ptr->s_writtenHi = 0;
+		}
+	}
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_nextAddress
+[Description] : This function is responsible for returning the DDRAM address the next data character of the lane
+				is written to, after the queued writes of the controller
+				
+[Args] :
+[in] Lcd* a_lcd_Ptr, uint8 a_ctrl:
+a_lcd_Ptr: pointer to the display handle
+a_ctrl: index of the controller
+[Returns] : The address, or LCD_ADDRESS_UNKNOWN if it is not known
+--------------------------------------------------------------------------------------------------------------- */
+static uint8 LCD_nextAddress(Lcd* a_lcd_Ptr, uint8 a_ctrl)
+{
+	LcdController* ctrl_Ptr = & a_lcd_Ptr->s_ctrl[a_ctrl];
+	uint8 address = ctrl_Ptr->s_lane[a_lcd_Ptr->s_lane].s_address;
+	
+	if ((ctrl_Ptr->s_lane[LCD_LANE_BACKGROUND].s_count != 0) || (ctrl_Ptr->s_lane[LCD_LANE_URGENT].s_count != 0))
+	{
+		return ctrl_Ptr->s_tail.s_address;
+	}
+	/* nothing is queued, the scheduler moves the cursor back where the lane stopped if the other lane moved it */
+	return (address != LCD_ADDRESS_UNKNOWN) ? address : ctrl_Ptr->s_mode.s_address;
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_laneXfer
+[Description] : This function is responsible for returning a place in the circular queue of a lane
+				
+[Args] :
+[in] LcdController* a_ctrl_Ptr, uint8 a_lane, uint8 a_index:
+a_ctrl_Ptr: pointer to the controller
+a_lane: LCD_LANE_BACKGROUND or LCD_LANE_URGENT
+a_index: index of the write from the head of the queue
+[Returns] : pointer to the queued write
+--------------------------------------------------------------------------------------------------------------- */
+static LcdXfer* LCD_laneXfer(LcdController* a_ctrl_Ptr, uint8 a_lane, uint8 a_index)
+{
+	uint8 index = a_ctrl_Ptr->s_lane[a_lane].s_head + a_index;
+	
+	if (a_lane == LCD_LANE_URGENT)
+	{
+		return & a_ctrl_Ptr->s_urgent[index % LCD_URGENT_DEPTH];
+	}
+	return & a_ctrl_Ptr->s_pending[index % LCD_PENDING_DEPTH];
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_execTime
+[Description] : This function is responsible for returning the time needed by the controller to execute a write
+				
+[Args] :
+[in] uint8 a_data, uint8 a_dataType:
+a_data: The data or command written
+a_dataType: LCD_XFER_CMD or LCD_XFER_DATA
+[Returns] : The execution time in micro seconds
+--------------------------------------------------------------------------------------------------------------- */
+static uint16 LCD_execTime(uint8 a_data, uint8 a_dataType)
+{
+	if (a_dataType == LCD_XFER_DATA)
+	{
+		return LCD_EXEC_DATA_US;
+	}
+	/* clear display 0x01 and return home 0x02/0x03 are the only long instructions */
+	if (a_data <= 0x03)
+	{
+		return LCD_EXEC_CLEAR_US;
+	}
+	return LCD_EXEC_US;
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_waitDeadline
+[Description] : This function is responsible for waiting till the bus time reaches a controller busy deadline, the
+				deadline is ignored if it is already reached or if it is older than the longest execution time
+				
+[Args] :
+[in] uint16 a_deadline:
+a_deadline: bus time in micro seconds
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+static void LCD_waitDeadline(uint16 a_deadline)
+{
+	sint16 wait = (sint16)(a_deadline - g_s_busClock);
+	
+	if ((wait > 0) && (wait <= LCD_EXEC_CLEAR_US))
+	{
+		/* the clear display and return home waits are long enough to sleep with LCD_SLEEP_WAITS */
+		if (LCD_SLEPT((uint16)wait) == 0)
+		{
+			/* _delay_loop_2 takes 4 cycles per count, (F_CPU/250000)/16 is the number of counts per micro second */
+			_delay_loop_2((uint16)((((uint32)wait * (F_CPU/250000UL)) >> 4) + 1));
+		}
+		g_s_busClock = a_deadline;
+	}
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_busWrite
+[Description] : This function is responsible for write on one controller of the LCD, it configure rs as low or high 
+				depending on Data Type whether its command or data, then send data to lcd data pins based on 
+				LCD_IO_MODE, and toggle the enable pin of this controller
+				
+[Args] :
+[in] Lcd* a_lcd_Ptr, uint8 a_ctrl, uint8 a_data, uint8 a_dataType:
+a_lcd_Ptr: pointer to the display handle
+a_ctrl: index of the controller
+a_data: The data to be sent to LCD
+a_dataType: the data type whether its a command or data
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+static void LCD_busWrite(Lcd* a_lcd_Ptr, uint8 a_ctrl, uint8 a_data, uint8 a_dataType)
+{	
+	if (a_dataType == LCD_XFER_CMD)		/* Data Type is Command */
+	{
+		/* write 0 on rs control bin */
+		LCD_rsLow(a_lcd_Ptr);
+	} 
+	else								/* Data Type is Data */
+	{
+		/* write 1 on rs control bin */
+		LCD_rsHigh(a_lcd_Ptr);
+	}
+	/* write 1 on rw control bin */
+	LCD_rwLow(a_lcd_Ptr);
+	/* address setup time before the enable rising edge */
+	OSC_DELAY_NS(LCD_T_SETUP_NS);
+	
+	#if (LCD_IO_MODE == 4)
+		/*	if 4-bit mode is used we will send data twice,
+		*	for we shift the data right by 4 to get 4 bits high nibble first
+		*/
+		LCD_writeBus(a_lcd_Ptr, a_data >> 4);
+		/* toggle enable pin for LCD to read data */
+		LCD_enToggle(a_lcd_Ptr, a_ctrl);
+	#endif
+	/* send the low nibble (or the whole byte in 8-bit mode) using the same method */
+	LCD_writeBus(a_lcd_Ptr, a_data);
+	/* toggle enable pin for LCD to read data */
+	LCD_enToggle(a_lcd_Ptr, a_ctrl);
+}
 
 /* ---------------------------------------------------------------------------------------------------------------
-[Function Name] : LCD_dataConfig
-[Description] :	This function is responsible for filling the data structures with the initial defined values in h 
-				file for each data pin, then set pin direction for them
+[Function Name] : LCD_resetWrite
+[Description] : This function is responsible for writing one function set of the reset sequence to all the
+				controllers of a display, as a single enable pulse on the high data lines, the data is put on the
+				bus once and each enable line is toggled
 				
 [Args] :
-[in] uint8 a_lcdPort, uint8 a_lcdPin:
-a_lcdPort: PORT Which the line is connect with: 'A 'B' 'C' or 'D'
-a_lcdPin: Pin number in the PORT: [0-7]
+[in] Lcd* a_lcd_Ptr, uint8 a_function:
+a_lcd_Ptr: pointer to the display handle
+a_function: LCD_FUNCTION_RESET or LCD_FUNCTION_4BIT, only its high nibble is read by the controller
 [Returns] : This function return void
 --------------------------------------------------------------------------------------------------------------- */
-static void LCD_dataConfig(uint8 a_lcdPort, uint8 a_lcdPin)
+static void LCD_resetWrite(Lcd* a_lcd_Ptr, uint8 a_function)
 {
-	/* local variable for loop iterations, declared as static to keep its value */
-	static uint8 loop = 0;
-	
-	/* fill initial value for each data pin, then set pin direction for them */
-	g_s_dataConfig[loop].s_port			= a_lcdPort;
-	g_s_dataConfig[loop].s_pinNum		= a_lcdPin;
-	g_s_dataConfig[loop].s_direction	= OUTPUT;
-	g_s_dataConfig[loop].s_value		= LOGIC_LOW;
+	uint8 ctrl;
 	
-	DIO_setPinDirection(& g_s_dataConfig[loop]);
-	loop++;
+	LCD_rsLow(a_lcd_Ptr);
+	LCD_rwLow(a_lcd_Ptr);
+	/* in 4-bit mode the high nibble goes to D4-D7, in 8-bit mode the whole byte */
+	LCD_writeBus(a_lcd_Ptr, a_function >> (8 - LCD_IO_MODE));
+	OSC_DELAY_NS(LCD_T_SETUP_NS);
+	for (ctrl=0;ctrl<a_lcd_Ptr->s_controllers;ctrl++)
+	{
+		LCD_enToggle(a_lcd_Ptr, ctrl);
+	}
 }
 
 /* ---------------------------------------------------------------------------------------------------------------
-[Function Name] : LCD_ctrlConfig
-[Description] :	This function is responsible for filling the control structures with the initial defined values in h
-				file for each data pin, then set pin direction for them
+[Function Name] : LCD_busRead
+[Description] : This function is responsible for reading one byte from a controller, the data pins are inputs while
+				RW is high and the controller drives them while the enable pin is high, in 4-bit mode the high 
+				nibble is read first
 				
 [Args] :
-[in] uint8 a_lcdPort, uint8 a_lcdPin:
-a_lcdPort: PORT Which the line is connect with: 'A 'B' 'C' or 'D'
-a_lcdPin: Pin number in the PORT: [0-7]
-[Returns] : This function return void
+[in] Lcd* a_lcd_Ptr, uint8 a_ctrl, uint8 a_dataType:
+a_lcd_Ptr: pointer to the display handle
+a_ctrl: index of the controller
+a_dataType: LCD_XFER_CMD for the busy flag and address counter or LCD_XFER_DATA for the DDRAM
+[Returns] : The byte read
 --------------------------------------------------------------------------------------------------------------- */
-static void LCD_ctrlConfig(uint8 a_lcdPort, uint8 a_lcdPin)
+static uint8 LCD_busRead(Lcd* a_lcd_Ptr, uint8 a_ctrl, uint8 a_dataType)
 {
-	/* local variable for loop iterations, declared as static to keep its value */
-	static uint8 loop = 0;
+	uint8 loop;
+	uint8 value = 0;
+	
+	for (loop=0;loop<LCD_IO_MODE;loop++)
+	{
+		a_lcd_Ptr->s_data[loop].s_direction = INPUT;
+		DIO_setPinDirection(& a_lcd_Ptr->s_data[loop]);
+	}
+	if (a_dataType == LCD_XFER_CMD)
+	{
+		LCD_rsLow(a_lcd_Ptr);
+	}
+	else
+	{
+		LCD_rsHigh(a_lcd_Ptr);
+	}
+	LCD_rwHigh(a_lcd_Ptr);
+	OSC_DELAY_NS(LCD_T_SETUP_NS);
 	
-	/* fill initial value for each control pin, then set pin direction for them */
-	g_s_ctrlConfig[loop].s_port			=	a_lcdPort;
-	g_s_ctrlConfig[loop].s_pinNum		=	a_lcdPin;
-	g_s_ctrlConfig[loop].s_direction	=	OUTPUT;
-	g_s_ctrlConfig[loop].s_value		=	LOGIC_LOW;
+	#if (LCD_IO_MODE == 4)
+		value = LCD_enRead(a_lcd_Ptr, a_ctrl) << 4;
+	#endif
+	value |= LCD_enRead(a_lcd_Ptr, a_ctrl);
 	
-	DIO_setPinDirection(& g_s_ctrlConfig[loop]);
-	loop++;
+	/* give the data pins back to the MCU */
+	LCD_rwLow(a_lcd_Ptr);
+	for (loop=0;loop<LCD_IO_MODE;loop++)
+	{
+		a_lcd_Ptr->s_data[loop].s_direction = OUTPUT;
+		DIO_setPinDirection(& a_lcd_Ptr->s_data[loop]);
+	}
+	return value;
 }
 
 /* ---------------------------------------------------------------------------------------------------------------
-[Function Name] : LCD_configurations
-[Description] : This function is responsible for filling the LCD data and control structures by calling the static 
-				functions LCD_dataConfig and LCD_ctrlConfig.
+[Function Name] : LCD_readBus
+[Description] : This function is responsible for reading one nibble (4-bit mode) or one byte (8-bit mode) from the
+				data pins of a display
 				
 [Args] :
-[in] void:
-[Returns] : This function return void
+[in] Lcd* a_lcd_Ptr:
+a_lcd_Ptr: pointer to the display handle which its data pins are used
+[Returns] : The nibble or byte read, bit 0 comes from s_data[0]
 --------------------------------------------------------------------------------------------------------------- */
-static void LCD_configurations()
-{	
-	/* fill port and pin number for LCD data pins depending on Data_IO_Mode */
-	/* Configure data pins from 0 to 3 only if 8-bit mode defined */
-	#if (LCD_IO_MODE == 8)								
-		LCD_dataConfig(LCD_DATA0_PORT, LCD_DATA0_PIN);
-		LCD_dataConfig(LCD_DATA1_PORT, LCD_DATA1_PIN);
-		LCD_dataConfig(LCD_DATA2_PORT, LCD_DATA2_PIN);
-		LCD_dataConfig(LCD_DATA3_PORT, LCD_DATA3_PIN);
-	#endif
-	/* Configure data pins from 4 to 7 whether its defined as 8-bit mode or 4-bit mode */
-	LCD_dataConfig(LCD_DATA4_PORT, LCD_DATA4_PIN);
-	LCD_dataConfig(LCD_DATA5_PORT, LCD_DATA5_PIN);
-	LCD_dataConfig(LCD_DATA6_PORT, LCD_DATA6_PIN);
-	LCD_dataConfig(LCD_DATA7_PORT, LCD_DATA7_PIN);
+static uint8 LCD_readBus(Lcd* a_lcd_Ptr)
+{
+	uint8 loop;
+	uint8 value = 0;
 	
-	/* fill port and pin number for RS, RW, EN LCD control pins */
-	LCD_ctrlConfig(LCD_RS_PORT, LCD_RS_PIN);
-	LCD_ctrlConfig(LCD_RW_PORT, LCD_RW_PIN);
-	LCD_ctrlConfig(LCD_EN_PORT, LCD_EN_PIN);
+	for (loop=0;loop<LCD_IO_MODE;loop++)
+	{
+		value |= (DIO_readPin(& a_lcd_Ptr->s_data[loop]) & 1) << loop;
+	}
+	return value;
 }
 
 /* ---------------------------------------------------------------------------------------------------------------
-[Function Name] : itoaAnsiC
-[Description] : This function is responsible for converting from integer to string to display number on LCD,
-				Ansi C "itoa" based on Kernighan & Ritchie's "Ansi C"
-				
-[Args]: sint32 a_value, uint8* a_str_Ptr, uint8 a_base
-a_value: the integer value to be converted
-a_str_Ptr: pointer to array of character which will hold the string value represent the integer number
-a_base: the value base number, binary, decimal, octal, hexadecimal, ..
-[in] void:
-[Returns] : This function return void
---------------------------------------------------------------------------------------------------------------- */
-static void itoaAnsiC(sint32 a_value, uint8* a_str_Ptr, uint8 a_base);
-
-/* ---------------------------------------------------------------------------------------------------------------
-[Function Name] : strreverse
-[Description] : This function is responsible for reversing string
+[Function Name] : LCD_readData
+[Description] : This function is responsible for reading the DDRAM character at the address counter of a controller
+				when it is not busy anymore, the address counter moves to the next character
 				
-[Args]: uint8* a_begin_Ptr, uint8* a_end_Ptr
-a_begin_Ptr: pointer to the start character
-a_end_Ptr: pointer to the end character
-[in] void:
-[Returns] : This function return void
+[Args] :
+[in] Lcd* a_lcd_Ptr, uint8 a_ctrl:
+a_lcd_Ptr: pointer to the display handle
+a_ctrl: index of the controller
+[Returns] : The character read
 --------------------------------------------------------------------------------------------------------------- */
-static void strreverse(uint8* a_begin_Ptr, uint8* a_end_Ptr);
+static uint8 LCD_readData(Lcd* a_lcd_Ptr, uint8 a_ctrl)
+{
+	uint8 value;
+	
+	LCD_waitDeadline(a_lcd_Ptr->s_ctrl[a_ctrl].s_deadline);
+	value = LCD_busRead(a_lcd_Ptr, a_ctrl, LCD_XFER_DATA);
+	a_lcd_Ptr->s_ctrl[a_ctrl].s_deadline = g_s_busClock + LCD_EXEC_DATA_US;
+	return value;
+}
 
 /* ---------------------------------------------------------------------------------------------------------------
-[Function Name] : LCD_write
-[Description] : This function is responsible for write on LCD, it configure rs as low or high depending on Data 
-				Type whether its command or data, then send data to lcd data pins based on LCD_IO_MODE, and toggle 
-				the enable pin
+[Function Name] : LCD_clearScreenInst
+[Description] : This function is responsible for clearing the lcd by sending the clearing command CLEAR_COMMAND
 				
 [Args] :
-[in] uint8 a_data, uint8 a_dataType:
-a_data: The data to be sent to LCD
-a_dataType: the data type whether its a command or data
+[in] Lcd* a_lcd_Ptr:
+a_lcd_Ptr: pointer to the display handle
 [Returns] : This function return void
 --------------------------------------------------------------------------------------------------------------- */
-static void LCD_write(uint8 a_data, uint8 a_dataType);
-
-static inline void LCD_enHigh(void);
-static inline void LCD_enLow(void);
-static inline void LCD_enToggle(void);
-static inline void LCD_rsHigh(void);
-static inline void LCD_rsLow(void);
-static inline void LCD_rwHigh(void);
-static inline void LCD_rwLow(void);
+void LCD_clearScreenInst(Lcd* a_lcd_Ptr)
+{
+	uint8 row;
+	uint8 loop;
+	LCD_PROF_BEGIN();
+	
+	if (a_lcd_Ptr->s_frame_Ptr != 0)
+	{
+		/* only the cells which are not spaces on the display are written */
+		LCD_frameFill(a_lcd_Ptr->s_frame_Ptr, 0);
+		for (row=0;row<a_lcd_Ptr->s_lines;row++)
+		{
+			a_lcd_Ptr->s_frame_Ptr->s_dirty |= (1 << row);
+		}
+		a_lcd_Ptr->s_frame_Ptr->s_row = 0;
+		a_lcd_Ptr->s_frame_Ptr->s_col = 0;
+	}
+	else if ((a_lcd_Ptr->s_crc_Ptr != 0) && (a_lcd_Ptr->s_crc_Ptr->s_pass != LCD_RENDER_OFF))
+	{
+		/* the hash pass forgets what is drawn before, the emit pass clears the display at its beginning */
+		if (a_lcd_Ptr->s_crc_Ptr->s_pass == LCD_RENDER_HASH)
+		{
+			a_lcd_Ptr->s_crc_Ptr->s_flags |= LCD_CRC_CLEARED;
+			for (loop=0;loop<LCD_CRC_SEGMENTS;loop++)
+			{
+				a_lcd_Ptr->s_crc_Ptr->s_work[loop] = 0;
+			}
+		}
+		a_lcd_Ptr->s_crc_Ptr->s_row = 0;
+		a_lcd_Ptr->s_crc_Ptr->s_col = 0;
+	}
+	else
+	{
+		/* clear display */
+		LCD_sendCommandInst(a_lcd_Ptr, LCD_CLR);
+	}
+	LCD_PROF_END(LCD_PROF_CLEAR);
+}
 
 /* ---------------------------------------------------------------------------------------------------------------
-[Function Name] : LCD_init
-[Description] :	This function is responsible for initialize the lcd data and control pins by call the static function
-				"LCD_configurations" which Fill the LCD Configuration structure for both data and control pins and 
-				initialize them with initial values, Prepare LCD to understand the 4-bit mode or 8-bit mode and set
-				cursor ON/OFF state and clear the LCD.
+[Function Name] : LCD_frameFill
+[Description] : This function is responsible for filling the front and/or back buffer of a frame with spaces
 				
 [Args] :
-[in] a_cursorState:
-a_cursorState is uint8 for the cursor state, LCD_CURSOR_OFF or LCD_CURSOR_ON
+[in] LcdFrame* a_frame_Ptr, uint8 a_front:
+a_frame_Ptr: pointer to the frame buffer
+a_front: 1 to fill the front buffer too, 0 to fill the back buffer only
 [Returns] : This function return void
 --------------------------------------------------------------------------------------------------------------- */
-void LCD_init(uint8 a_cursorState)
+static void LCD_frameFill(LcdFrame* a_frame_Ptr, uint8 a_front)
 {
-	/*	Fill the LCD Configuration structure for both data and control pins and initialize them with initial data */
-	LCD_configurations();
-	
-	#if (LCD_IO_MODE==4)
-		/*	Prepare LCD to understand the 4-bit mode
-		*	When the power supply is given to LCD, it remains by default in 8-bit mode. 
-		*	If 0x20 is sent, lower nibble will not be received by LCD because four data lines (D4-D7) are connected, 
-		*	so 0x02 is sent instead of 0x20 to initiate it for 4-bit mode 
-		*/
-		LCD_sendCommand(LCD_FUNCTION_2_LINES);	
-	#endif
-	
-	/*  LCD_FUNCTION_DEFAULT is defined in the header file based on number of lines and LCD_IO_MODE type
-	*	(1 or 2)-line lcd + (4 or 8)-bit Data Mode + 5*7 dot display Mode 
-	*/
-	LCD_sendCommand(LCD_FUNCTION_DEFAULT);
+	uint8 row;
+	uint8 col;
 	
-	/* Setting cursor state ON/OFF */
-	LCD_sendCommand(a_cursorState);
-	/* clear LCD at the beginning */
-	LCD_sendCommand(LCD_CLR); 
+	for (row=0;row<LCD_MAX_LINES;row++)
+	{
+		for (col=0;col<LCD_MAX_LENGTH;col++)
+		{
+			a_frame_Ptr->s_back[row][col] = ' ';
+			if (a_front)
+			{
+				a_frame_Ptr->s_front[row][col] = ' ';
+			}
+		}
+	}
 }
 
 /* ---------------------------------------------------------------------------------------------------------------
-[Function Name] : LCD_sendCommand
-[Description] : This function is responsible for sending command to the lcd, it call the LCD_write function which
-				takes two parameters, 1st the data to be sent to LCD, and the data type whether it's a data character 
-				or a command byte, so we call LCD_write and send 0 to indicate that it's a command
+[Function Name] : LCD_frameStep
+[Description] : This function is responsible for queuing the first changed cell of a frame in the DDRAM address 
+				order, so a line which continues another one in the DDRAM (line 3 after line 1 of a 20x4 module)
+				is written right after it. The planner chooses the cheaper way to bring the cursor to the cell: no
+				write if it is there already, re-sending the unchanged cells before it, or a cursor location
+				command. The front buffer is updated when the cell is queued, the cells are always written in the
+				background lane
 				
 [Args] :
-[in] uint8 a_command:
-The command to be executed in the LCD
-[Returns] : This function return void
+[in] Lcd* a_lcd_Ptr:
+a_lcd_Ptr: pointer to the display handle, it must have a frame
+[Returns] : This function return 1 if a cell is queued or 0 if the frame has no changed cell or is held
 --------------------------------------------------------------------------------------------------------------- */
-void LCD_sendCommand(uint8 a_command)
+static uint8 LCD_frameStep(Lcd* a_lcd_Ptr)
 {
-	LCD_write(a_command, 0);
+	LcdFrame* frame_Ptr = a_lcd_Ptr->s_frame_Ptr;
+	uint8 order[LCD_MAX_LINES];
+	uint8 loop;
+	uint8 next;
+	uint8 row;
+	uint8 col;
+	uint8 ctrl;
+	uint8 gap;
+	uint8 gapCol;
+	uint8 lane;
+	
+	if (frame_Ptr->s_hold)
+	{
+		/* the next screen is still being drawn */
+		return 0;
+	}
+	/* sort the lines by controller and DDRAM address */
+	for (loop=0;loop<a_lcd_Ptr->s_lines;loop++)
+	{
+		for (next=loop; (next > 0) && 
+			(((uint16)a_lcd_Ptr->s_lineCtrl[order[next-1]] << 8 | a_lcd_Ptr->s_lineStart[order[next-1]]) >
+			 ((uint16)a_lcd_Ptr->s_lineCtrl[loop] << 8 | a_lcd_Ptr->s_lineStart[loop])); next--)
+		{
+			order[next] = order[next-1];
+		}
+		order[next] = loop;
+	}
+	
+	for (loop=0;loop<a_lcd_Ptr->s_lines;loop++)
+	{
+		row = order[loop];
+		if ((frame_Ptr->s_dirty & (1 << row)) == 0)
+		{
+			continue;
+		}
+		for (col=0;col<a_lcd_Ptr->s_length;col++)
+		{
+			if (frame_Ptr->s_back[row][col] == frame_Ptr->s_front[row][col])
+			{
+				continue;
+			}
+			lane = a_lcd_Ptr->s_lane;
+			a_lcd_Ptr->s_lane = LCD_LANE_BACKGROUND;
+			/* the runs go to the right whatever the text direction, the direct writes may have left it to the left */
+			LCD_entrySync(a_lcd_Ptr, LCD_DIRECTION_LTR);
+			ctrl = a_lcd_Ptr->s_lineCtrl[row];
+			gap = LCD_frameGap(a_lcd_Ptr, row, col);
+			
+			if ((frame_Ptr->s_nextRow[ctrl] != row) || (frame_Ptr->s_nextCol[ctrl] != col))
+			{
+				/* a new run, the cells between are not changed (the first changed cell is taken) */
+				a_lcd_Ptr->s_stats.s_runs++;
+				if (gap == 0)
+				{
+					a_lcd_Ptr->s_stats.s_continuedRuns++;
+					a_lcd_Ptr->s_stats.s_savedUs += a_lcd_Ptr->s_cmdCost;
+				}
+				else if ((gap != LCD_ADDRESS_UNKNOWN) &&
+						 ((uint32)gap * a_lcd_Ptr->s_dataCost < a_lcd_Ptr->s_cmdCost))
+				{
+					a_lcd_Ptr->s_stats.s_joinedRuns++;
+					a_lcd_Ptr->s_stats.s_resentCells += gap;
+					a_lcd_Ptr->s_stats.s_savedUs += a_lcd_Ptr->s_cmdCost - (uint16)gap * a_lcd_Ptr->s_dataCost;
+					/* re-send the cells from the cursor, going to the next line in the DDRAM at the line end */
+					next = frame_Ptr->s_nextRow[ctrl];
+					gapCol = frame_Ptr->s_nextCol[ctrl];
+					for (;gap != 0;gap--)
+					{
+						if (gapCol == a_lcd_Ptr->s_length)
+						{
+							next = row;
+							gapCol = 0;
+						}
+						LCD_write(a_lcd_Ptr, frame_Ptr->s_front[next][gapCol], LCD_XFER_DATA);
+						gapCol++;
+					}
+				}
+				else
+				{
+					a_lcd_Ptr->s_stats.s_addressCmds++;
+					LCD_goToAddress(a_lcd_Ptr, row, col);
+				}
+			}
+			a_lcd_Ptr->s_activeCtrl[LCD_LANE_BACKGROUND] = ctrl;
+			LCD_write(a_lcd_Ptr, frame_Ptr->s_back[row][col], LCD_XFER_DATA);
+			a_lcd_Ptr->s_lane = lane;
+			
+			frame_Ptr->s_front[row][col]	= frame_Ptr->s_back[row][col];
+			frame_Ptr->s_nextRow[ctrl]		= row;
+			frame_Ptr->s_nextCol[ctrl]		= col + 1;
+			return 1;
+		}
+		/* no changed cell is left in this line */
+		frame_Ptr->s_dirty &= ~(1 << row);
+	}
+	return 0;
 }
 
 /* ---------------------------------------------------------------------------------------------------------------
-[Function Name] : LCD_displayCharacter
-[Description] : This function is responsible for sending character to the lcd, it call the LCD_write function which
-				takes two parameters, 1st the data to be sent to LCD, and the data type whether it's a data character 
-				or a command byte, so we call LCD_write and send 1 to indicate that it's a data not command
+[Function Name] : LCD_frameGap
+[Description] : This function is responsible for counting the cells between the cursor of a controller and a cell
+				of the frame, the cursor can reach the cell by writing these cells if they are after it on the
+				same line, or on the line which continues the cursor line in the DDRAM
 				
 [Args] :
-[in] uint8 a_command:
-The command to be executed in the LCD
-[Returns] : This function return void
+[in] Lcd* a_lcd_Ptr, uint8 a_row, uint8 a_col:
+a_lcd_Ptr: pointer to the display handle, it must have a frame
+a_row, a_col: the cell
+[Returns] : The number of cells the cursor passes before reaching the cell, or LCD_ADDRESS_UNKNOWN if it can't
 --------------------------------------------------------------------------------------------------------------- */
-void LCD_displayCharacter(uint8 a_dataCharacter)
+static uint8 LCD_frameGap(Lcd* a_lcd_Ptr, uint8 a_row, uint8 a_col)
 {
-	LCD_write(a_dataCharacter, 1);
+	uint8 ctrl = a_lcd_Ptr->s_lineCtrl[a_row];
+	uint8 row = a_lcd_Ptr->s_frame_Ptr->s_nextRow[ctrl];
+	uint8 col = a_lcd_Ptr->s_frame_Ptr->s_nextCol[ctrl];
+	uint16 gap;
+	
+	if (row == LCD_ADDRESS_UNKNOWN)
+	{
+		return LCD_ADDRESS_UNKNOWN;
+	}
+	if (row == a_row)
+	{
+		return (a_col >= col) ? (a_col - col) : LCD_ADDRESS_UNKNOWN;
+	}
+	if ((a_lcd_Ptr->s_lineCtrl[row] == ctrl) &&
+		(a_lcd_Ptr->s_lineStart[a_row] == (uint8)(a_lcd_Ptr->s_lineStart[row] + a_lcd_Ptr->s_length)))
+	{
+		gap = (uint16)(a_lcd_Ptr->s_length - col) + a_col;
+		if (gap < LCD_ADDRESS_UNKNOWN)
+		{
+			return (uint8)gap;
+		}
+	}
+	return LCD_ADDRESS_UNKNOWN;
 }
 
 /* ---------------------------------------------------------------------------------------------------------------
-[Function Name] : LCD_displayString
-[Description] : This function is responsible for displaying string on the lcd, by displaying it character by character
-				till it reach the terminator character
+[Function Name] : LCD_frameCursorLost
+[Description] : This function is responsible for forgetting the cursor cells of all controllers of a frame, after a
+				command which may move the cursor
 				
 [Args] :
-[in] const uint8 *a_dataString_Ptr:
-a_dataString_Ptr is a pointer to character
+[in] LcdFrame* a_frame_Ptr:
+a_frame_Ptr: pointer to the frame buffer
 [Returns] : This function return void
 --------------------------------------------------------------------------------------------------------------- */
-void LCD_displayString(const uint8 *a_dataString_Ptr)
+static void LCD_frameCursorLost(LcdFrame* a_frame_Ptr)
 {
-	while(*a_dataString_Ptr != '\0')
+	uint8 ctrl;
+	
+	for (ctrl=0;ctrl<LCD_MAX_CONTROLLERS;ctrl++)
 	{
-		/* Send character to LCD_displayCharacter function then post increment the pointer */
-		LCD_displayCharacter(*a_dataString_Ptr++);
+		a_frame_Ptr->s_nextRow[ctrl] = LCD_ADDRESS_UNKNOWN;
 	}
 }
 
 /* ---------------------------------------------------------------------------------------------------------------
-[Function Name] : LCD_displayNumber
-[Description] : This function is responsible for displaying integer numbers on the lcd by converting this integer 
-				to string using the itoa function and then display it as string, the value can be represented as
-				binary, decimal, octal, hexadecimal, or any other base from 2 to 35.
+[Function Name] : LCD_crcCharacter
+[Description] : This function is responsible for drawing one character of a render. The hash pass adds its column
+				and value to the CRC of its span, the emit pass sends it if its span changed (or the screen is
+				cleared by the render, then spaces are not sent), with the cursor location command before it if the
+				cursor is not on its cell. Characters out of the visible line are dropped
 				
 [Args] :
-[in] uint16 a_data, uint8 a_base:
-a_data: The number value to be displayed on the LCD
-a_base: The number base to be displayed on the LCD 
-	Base can be any integer number from 2 to 35
-		2 represent binary,
-		8 represent octal,
-		10 represent decimal, 
-		16 represent hexadecimal, ..etc
+[in] Lcd* a_lcd_Ptr, uint8 a_dataCharacter:
+a_lcd_Ptr: pointer to the display handle, it must be inside a render
+a_dataCharacter: The character to be displayed
 [Returns] : This function return void
 --------------------------------------------------------------------------------------------------------------- */
-void LCD_displayNumber(sint32 a_data, uint8 a_base)
+static void LCD_crcCharacter(Lcd* a_lcd_Ptr, uint8 a_dataCharacter)
 {
-	/* String to hold the ascii result */
-	uint8 buff[LCD_DISP_LENGTH];
-	/* Base can be 10 for decimal, 8 for octal, ..etc, can be from 2 to 35 */
-	itoaAnsiC(a_data,buff,a_base);
-	LCD_displayString(buff);
+	LcdCrcFrame* crc_Ptr = a_lcd_Ptr->s_crc_Ptr;
+	uint8 row = crc_Ptr->s_row;
+	uint8 col = crc_Ptr->s_col;
+	uint16 segment;
+	uint8 send;
+	
+	if (col >= a_lcd_Ptr->s_length)
+	{
+		return;
+	}
+	if (a_lcd_Ptr->s_direction == LCD_DIRECTION_RTL)
+	{
+		crc_Ptr->s_col = (col == 0) ? LCD_COL_PAST_START : (col - 1);
+	}
+	else
+	{
+		crc_Ptr->s_col++;
+	}
+	segment = (uint16)row * ((a_lcd_Ptr->s_length + LCD_CRC_SPAN - 1) / LCD_CRC_SPAN) + (col / LCD_CRC_SPAN);
+	
+	if (crc_Ptr->s_pass == LCD_RENDER_HASH)
+	{
+		if (segment < LCD_CRC_SEGMENTS)
+		{
+			crc_Ptr->s_work[segment] = LCD_crc8(LCD_crc8(crc_Ptr->s_work[segment], col), a_dataCharacter);
+		}
+		else
+		{
+			crc_Ptr->s_flags |= LCD_CRC_UNHASHED;
+		}
+		return;
+	}
+	
+	if (crc_Ptr->s_flags & LCD_CRC_CLEARED)
+	{
+		send = (a_dataCharacter != ' ');
+	}
+	else
+	{
+		send = ((crc_Ptr->s_flags & LCD_CRC_VALID) == 0) || (segment >= LCD_CRC_SEGMENTS) ||
+			   (crc_Ptr->s_work[segment] != crc_Ptr->s_hash[segment]);
+	}
+	if (send)
+	{
+		if (a_lcd_Ptr->s_direction != LCD_DIRECTION_KEEP)
+		{
+			LCD_entrySync(a_lcd_Ptr, a_lcd_Ptr->s_direction);
+		}
+		if ((crc_Ptr->s_nextRow != row) || (crc_Ptr->s_nextCol != col))
+		{
+			LCD_goToAddress(a_lcd_Ptr, row, col);
+		}
+		LCD_write(a_lcd_Ptr, a_dataCharacter, LCD_XFER_DATA);
+		crc_Ptr->s_nextRow = row;
+		crc_Ptr->s_nextCol = crc_Ptr->s_col;
+	}
 }
 
 /* ---------------------------------------------------------------------------------------------------------------
-[Function Name] : LCD_goToRowColumn
-[Description] : This function is responsible for moving the cursor to a specific row and column on the lcd screen
+[Function Name] : LCD_entrySync
+[Description] : This function is responsible for queuing the entry mode of a text direction if the last queued
+				entry mode of the display is not this one, the display shift bit is kept
 				
 [Args] :
-[in] uint8 a_row,uint8 a_col:
-uint8 a_row, the row number
-uint8 a_col, the column number
+[in] Lcd* a_lcd_Ptr, uint8 a_direction:
+a_lcd_Ptr: pointer to the display handle
+a_direction: LCD_DIRECTION_LTR or LCD_DIRECTION_RTL
 [Returns] : This function return void
 --------------------------------------------------------------------------------------------------------------- */
-void LCD_goToRowColumn(uint8 a_row,uint8 a_col)
+static void LCD_entrySync(Lcd* a_lcd_Ptr, uint8 a_direction)
 {
-	/* local variable to hold the LCD address value for the cursor */
-	uint8 address;
+	uint8 entryMode = (a_direction == LCD_DIRECTION_RTL) ? LCD_ENTRY_DEC : LCD_ENTRY_INC;
 	
-	/* first of all calculate the required address */
-	switch(a_row)
+	if (a_lcd_Ptr->s_entryMode != LCD_ADDRESS_UNKNOWN)
 	{
-		case 0:
-				address = a_col + LCD_START_LINE1;
-				break;
-		case 1:
-				address = a_col + LCD_START_LINE2;
-				break;
-		case 2:
-				address = a_col + LCD_START_LINE3;
-				break;
-		case 3:
-				address = a_col + LCD_START_LINE4;
-				break;
-		default:
-				address = a_col + LCD_START_LINE1;
-				break;
-	}					
-	/* to write to a specific address in the LCD 
-	 * we need to apply the corresponding command 0b10000000+address 
-	*/
-	LCD_sendCommand(address|SET_CURSOR_LOCATION); 
+		entryMode |= (a_lcd_Ptr->s_entryMode & LCD_ENTRY_SHIFT_BIT);
+	}
+	if (a_lcd_Ptr->s_entryMode != entryMode)
+	{
+		LCD_write(a_lcd_Ptr, entryMode, LCD_XFER_CMD);
+	}
 }
 
 /* ---------------------------------------------------------------------------------------------------------------
-[Function Name] : LCD_displayStringRowColumn
-[Description] : This function is responsible for moving the cursor to a specific row and column on the lcd screen
-				and display a string from this position
+[Function Name] : LCD_crc8
+[Description] : This function is responsible for adding one byte to a CRC-8, polynomial x^8 + x^2 + x + 1, bit by
+				bit so no table is needed in the flash
 				
 [Args] :
-[in] uint8 a_row,uint8 a_col,const char *a_str_Ptr:
-uint8 a_row, the row number
-uint8 a_col, the column number
-const char *a_str_Ptr, pointer to the sting to be displayed character by charater using displayCharacter function 
-[Returns] : This function return void
+[in] uint8 a_crc, uint8 a_data:
+a_crc: the CRC of the previous bytes
+a_data: the byte to be added
+[Returns] : The new CRC
 --------------------------------------------------------------------------------------------------------------- */
-void LCD_displayStringRowColumn(uint8 a_row, uint8 a_col, const uint8 *a_str_Ptr)
+static uint8 LCD_crc8(uint8 a_crc, uint8 a_data)
 {
-	/* go to to the required LCD position */
-	LCD_goToRowColumn(a_row, a_col);
-	/* display the string */
-	LCD_displayString(a_str_Ptr);
+	uint8 loop;
+	
+	a_crc ^= a_data;
+	for (loop=0;loop<8;loop++)
+	{
+		a_crc = (a_crc & 0x80) ? (uint8)((a_crc << 1) ^ 0x07) : (uint8)(a_crc << 1);
+	}
+	return a_crc;
 }
 
 /* ---------------------------------------------------------------------------------------------------------------
-[Function Name] : LCD_write
-[Description] : This function is responsible for write on LCD, it configure rs as low or high depending on Data 
-				Type whether its command or data, then send data to lcd data pins based on LCD_IO_MODE, and toggle 
-				the enable pin
+[Function Name] : LCD_workLeft
+[Description] : This function is responsible for counting the queued writes and the changed frame cells of all the
+				displays
 				
 [Args] :
-[in] uint8 a_data, uint8 a_dataType:
-a_data: The data to be sent to LCD
-a_dataType: the data type whether its a command or data
-[Returns] : This function return void
+[in] void:
+[Returns] : The number of queued writes and changed cells
 --------------------------------------------------------------------------------------------------------------- */
-static void LCD_write (uint8 a_data, uint8 a_dataType)
-{	
-	uint8 loop;
-	if (a_dataType == 0)				/* Data Type is Command */
-	{
-		/* write 0 on rs control bin */
-		LCD_rsLow();
-	} 
-	else								/* Data Type is Data */
-	{
-		/* write 1 on rs control bin */
-		LCD_rsHigh();
-	}
-	/* write 1 on rw control bin */
-	LCD_rwLow();
+static uint16 LCD_workLeft(void)
+{
+	Lcd* lcd_Ptr;
+	uint16 left = 0;
+	uint8 ctrl;
+	uint8 row;
+	uint8 col;
 	
-	#if (LCD_IO_MODE == 8)
-		for (loop=0;loop<LCD_IO_MODE;loop++)
-		{
-			/*	write each bit in the data value on each corresponding pin
-			*	shift the data from [0-7] and AND it with 1 to get only the bit value 
-			*	then write this bit to data bin
-			*/
-			g_s_dataConfig[loop].s_value = ((a_data >> loop) & 1);
-			DIO_writePin(& g_s_dataConfig[loop]);
-		}
-	#elif (LCD_IO_MODE == 4)
-		for (loop=0;loop<LCD_IO_MODE;loop++)
+	for (lcd_Ptr=g_s_lcdList; lcd_Ptr != 0; lcd_Ptr=lcd_Ptr->s_next)
+	{
+		for (ctrl=0;ctrl<lcd_Ptr->s_controllers;ctrl++)
 		{
-			/*	if 4-bit mode is used we will send data twice,
-			*	write each bit in the data value on each corresponding pin
-			*	for we shift the data right by 4 to get 4 bits high nibble and then shift
-			*	these bit [0-3] and ANDing the whole byte with 1 to get each bit value 
-			*	then write this bit to data bin
-			*/
-			g_s_dataConfig[loop].s_value = (((a_data>>4) >> loop) & 1);
-			DIO_writePin(& g_s_dataConfig[loop]);
+			left += lcd_Ptr->s_ctrl[ctrl].s_lane[LCD_LANE_BACKGROUND].s_count;
+			left += lcd_Ptr->s_ctrl[ctrl].s_lane[LCD_LANE_URGENT].s_count;
 		}
-		/* toggle enable pin for LCD to read data */
-		LCD_enToggle();
-		/* send the low nibbles using the same method */
-		for (loop=0;loop<LCD_IO_MODE;loop++)
+		if ((lcd_Ptr->s_frame_Ptr != 0) && (lcd_Ptr->s_frame_Ptr->s_hold == 0))
 		{
-			g_s_dataConfig[loop].s_value = ((a_data >> loop) & 1);
-			DIO_writePin(& g_s_dataConfig[loop]);
+			for (row=0;row<lcd_Ptr->s_lines;row++)
+			{
+				if (lcd_Ptr->s_frame_Ptr->s_dirty & (1 << row))
+				{
+					for (col=0;col<lcd_Ptr->s_length;col++)
+					{
+						if (lcd_Ptr->s_frame_Ptr->s_back[row][col] != lcd_Ptr->s_frame_Ptr->s_front[row][col])
+						{
+							left++;
+						}
+					}
+				}
+			}
 		}
-	#endif
-	/* toggle enable pin for LCD to read data */
-	LCD_enToggle();
+	}
+	return left;
 }
 
 /* ---------------------------------------------------------------------------------------------------------------
-[Function Name] : LCD_clearScreen
-[Description] : This function is responsible for clearing the lcd by sending the clearing command CLEAR_COMMAND
+[Function Name] : LCD_enToggle
+[Description] : This inline function is responsible for toggle enable pin of a controller by setting it high then 
+				delay then low for LCD to read the data on data line the en control pin need to be toggles, the 
+				pulse width and the rest of the enable cycle are cycle exact delays from F_CPU, the enable cycle
+				is added to the bus time
 				
 [Args] :
-[in] void:
+[in] Lcd* a_lcd_Ptr, uint8 a_ctrl:
+a_lcd_Ptr: pointer to the display handle
+a_ctrl: index of the controller
 [Returns] : This function return void
 --------------------------------------------------------------------------------------------------------------- */
-void LCD_clearScreen(void)
+static inline void LCD_enToggle(Lcd* a_lcd_Ptr, uint8 a_ctrl)
 {
-	/* clear display */
-	LCD_sendCommand(LCD_CLR);
+	LCD_enHigh(a_lcd_Ptr, a_ctrl);
+	OSC_DELAY_NS(LCD_T_PULSE_NS);
+	LCD_enLow(a_lcd_Ptr, a_ctrl);
+	OSC_DELAY_NS(LCD_T_CYCLE_NS - LCD_T_PULSE_NS);
+	g_s_busClock += LCD_EN_PULSE_US;
 }
 
 /* ---------------------------------------------------------------------------------------------------------------
-[Function Name] : LCD_enToggle
-[Description] : This inline function is responsible for toggle enable pin by setting it high then delay then low
-				for LCD to read the data on data line the en control pin need to be toggles
+[Function Name] : LCD_enRead
+[Description] : This inline function is responsible for one read enable cycle of a controller, the data pins are
+				read when the controller output is valid and held for the pulse width, the enable cycle is added 
+				to the bus time
 				
 [Args] :
-[in] void:
-[Returns] : This function return void
+[in] Lcd* a_lcd_Ptr, uint8 a_ctrl:
+a_lcd_Ptr: pointer to the display handle
+a_ctrl: index of the controller
+[Returns] : The nibble (4-bit mode) or byte (8-bit mode) read
 --------------------------------------------------------------------------------------------------------------- */
-static inline void LCD_enToggle(void)
+static inline uint8 LCD_enRead(Lcd* a_lcd_Ptr, uint8 a_ctrl)
 {
-	LCD_enHigh();
-	_delay_ms(1);
-	LCD_enLow();
+	uint8 value;
+	
+	LCD_enHigh(a_lcd_Ptr, a_ctrl);
+	#if (LCD_T_READ_NS > LCD_T_PULSE_NS)
+		OSC_DELAY_NS(LCD_T_READ_NS);
+	#else
+		OSC_DELAY_NS(LCD_T_PULSE_NS);
+	#endif
+	value = LCD_readBus(a_lcd_Ptr);
+	LCD_enLow(a_lcd_Ptr, a_ctrl);
+	OSC_DELAY_NS(LCD_T_CYCLE_NS - LCD_T_PULSE_NS);
+	g_s_busClock += LCD_EN_PULSE_US;
+	return value;
 }
 
 /* ---------------------------------------------------------------------------------------------------------------
@@ -450,13 +3494,15 @@ static inline void LCD_enToggle(void)
 [Description] : This inline function is responsible for set enable pin to high by write LOGIC_HIGH on it
 				
 [Args] :
-[in] void:
+[in] Lcd* a_lcd_Ptr, uint8 a_ctrl:
+a_lcd_Ptr: pointer to the display handle
+a_ctrl: index of the controller
 [Returns] : This function return void
 --------------------------------------------------------------------------------------------------------------- */
-static inline void LCD_enHigh(void)
+static inline void LCD_enHigh(Lcd* a_lcd_Ptr, uint8 a_ctrl)
 {
-	g_s_ctrlConfig[2].s_value = LOGIC_HIGH;
-	DIO_writePin(& g_s_ctrlConfig[2]);
+	a_lcd_Ptr->s_ctrl[a_ctrl].s_en.s_value = LOGIC_HIGH;
+	DIO_writePin(& a_lcd_Ptr->s_ctrl[a_ctrl].s_en);
 }
 
 /* ---------------------------------------------------------------------------------------------------------------
@@ -464,13 +3510,15 @@ static inline void LCD_enHigh(void)
 [Description] : This inline function is responsible for set enable pin to high by write LOGIC_LOW on it
 				
 [Args] :
-[in] void:
+[in] Lcd* a_lcd_Ptr, uint8 a_ctrl:
+a_lcd_Ptr: pointer to the display handle
+a_ctrl: index of the controller
 [Returns] : This function return void
 --------------------------------------------------------------------------------------------------------------- */
-static inline void LCD_enLow(void)
+static inline void LCD_enLow(Lcd* a_lcd_Ptr, uint8 a_ctrl)
 {
-	g_s_ctrlConfig[2].s_value = LOGIC_LOW;
-	DIO_writePin(& g_s_ctrlConfig[2]);
+	a_lcd_Ptr->s_ctrl[a_ctrl].s_en.s_value = LOGIC_LOW;
+	DIO_writePin(& a_lcd_Ptr->s_ctrl[a_ctrl].s_en);
 }
 
 /* ---------------------------------------------------------------------------------------------------------------
@@ -478,13 +3526,14 @@ static inline void LCD_enLow(void)
 [Description] : This inline function is responsible for set rs pin to high by write LOGIC_HIGH on it
 				
 [Args] :
-[in] void:
+[in] Lcd* a_lcd_Ptr:
+a_lcd_Ptr: pointer to the display handle
 [Returns] : This function return void
 --------------------------------------------------------------------------------------------------------------- */
-static inline void LCD_rsHigh(void)
+static inline void LCD_rsHigh(Lcd* a_lcd_Ptr)
 {
-	g_s_ctrlConfig[0].s_value = LOGIC_HIGH;
-	DIO_writePin(& g_s_ctrlConfig[0]);
+	a_lcd_Ptr->s_rs.s_value = LOGIC_HIGH;
+	DIO_writePin(& a_lcd_Ptr->s_rs);
 }
 
 /* ---------------------------------------------------------------------------------------------------------------
@@ -492,13 +3541,14 @@ static inline void LCD_rsHigh(void)
 [Description] : This inline function is responsible for set rs pin to low by write LOGIC_LOW on it
 				
 [Args] :
-[in] void:
+[in] Lcd* a_lcd_Ptr:
+a_lcd_Ptr: pointer to the display handle
 [Returns] : This function return void
 --------------------------------------------------------------------------------------------------------------- */
-static inline void LCD_rsLow(void)
+static inline void LCD_rsLow(Lcd* a_lcd_Ptr)
 {
-	g_s_ctrlConfig[0].s_value = LOGIC_LOW;
-	DIO_writePin(& g_s_ctrlConfig[0]);
+	a_lcd_Ptr->s_rs.s_value = LOGIC_LOW;
+	DIO_writePin(& a_lcd_Ptr->s_rs);
 }
 
 /* ---------------------------------------------------------------------------------------------------------------
@@ -506,13 +3556,14 @@ static inline void LCD_rsLow(void)
 [Description] : This inline function is responsible for set rw pin to high by write LOGIC_HIGH on it
 				
 [Args] :
-[in] void:
+[in] Lcd* a_lcd_Ptr:
+a_lcd_Ptr: pointer to the display handle
 [Returns] : This function return void
 --------------------------------------------------------------------------------------------------------------- */
-static inline void LCD_rwHigh(void)
+static inline void LCD_rwHigh(Lcd* a_lcd_Ptr)
 {
-	g_s_ctrlConfig[1].s_value = LOGIC_HIGH;
-	DIO_writePin(& g_s_ctrlConfig[1]);
+	a_lcd_Ptr->s_rw.s_value = LOGIC_HIGH;
+	DIO_writePin(& a_lcd_Ptr->s_rw);
 }
 
 /* ---------------------------------------------------------------------------------------------------------------
@@ -520,13 +3571,14 @@ static inline void LCD_rwHigh(void)
 [Description] : This inline function is responsible for set rw pin to low by write LOGIC_LOW on it
 				
 [Args] :
-[in] void:
+[in] Lcd* a_lcd_Ptr:
+a_lcd_Ptr: pointer to the display handle
 [Returns] : This function return void
 --------------------------------------------------------------------------------------------------------------- */
-static inline void LCD_rwLow(void)
+static inline void LCD_rwLow(Lcd* a_lcd_Ptr)
 {
-	g_s_ctrlConfig[1].s_value = LOGIC_LOW;
-	DIO_writePin(& g_s_ctrlConfig[1]);
+	a_lcd_Ptr->s_rw.s_value = LOGIC_LOW;
+	DIO_writePin(& a_lcd_Ptr->s_rw);
 }
 
 /* ---------------------------------------------------------------------------------------------------------------
@@ -545,7 +3597,7 @@ static void itoaAnsiC(sint32 a_value, uint8* a_str_Ptr, uint8 a_base) {
 	
 	static uint8 num[] = "0123456789abcdefghijklmnopqrstuvwxyz";
 	uint8* wstr_Ptr = a_str_Ptr;
-	sint32 sign;
+	uint32 magnitude = (uint32)a_value;
 	
 	/* check if base is Validate or no */
 	if (a_base<2 || a_base>35)
@@ -554,19 +3606,30 @@ static void itoaAnsiC(sint32 a_value, uint8* a_str_Ptr, uint8 a_base) {
 		return; 
 	}
 	
-	/* Take care of sign */
-	if ((sign = a_value) < 0)
+	/* Take care of sign, the magnitude of the lowest sint32 is only an uint32 */
+	if (a_value < 0)
+	{
+		magnitude = (uint32)0 - magnitude;
+	}
+	
+	if (a_base == 10)
 	{
-		a_value = -a_value;	
+		/* decimal without division, the digits are in order */
+		if (a_value < 0)
+		{
+			*wstr_Ptr++ = '-';
+		}
+		(void)LCD_decimal(magnitude, wstr_Ptr);
+		return;
 	}
 	
 	/* Conversion. Number is reversed. */
 	do
 	{ 
-		*wstr_Ptr++ = num[a_value%a_base]; 
-	}while(a_value /= a_base);
+		*wstr_Ptr++ = num[magnitude%a_base]; 
+	}while(magnitude /= a_base);
 	
-	if(sign<0)
+	if(a_value<0)
 	{ 
 		*wstr_Ptr++='-';
 	}
@@ -595,4 +3658,43 @@ static void strreverse(uint8* a_begin_Ptr, uint8* a_end_Ptr) {
 		*a_end_Ptr--	=	*a_begin_Ptr;
 		*a_begin_Ptr++	=	aux;
 	}
-}
\ No newline at end of file
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_decimal
+[Description] : This function is responsible for converting an unsigned integer to its decimal digits by subtracting
+				the powers of ten, at most 9 subtractions per digit instead of a 32-bit division, the digits come
+				in their order so the string is not reversed
+				
+[Args] :
+[in] uint32 a_value, uint8* a_str_Ptr:
+a_value: the integer value to be converted
+a_str_Ptr: pointer to at least 11 characters which will hold the digits and the terminator
+[Returns] : The number of digits
+--------------------------------------------------------------------------------------------------------------- */
+static uint8 LCD_decimal(uint32 a_value, uint8* a_str_Ptr)
+{
+	uint32 power;
+	uint8 length = 0;
+	uint8 loop;
+	uint8 digit;
+	
+	for (loop=0;loop<(sizeof(g_s_powersOfTen) / sizeof(g_s_powersOfTen[0]));loop++)
+	{
+		power = FLASH_READ_DWORD(& g_s_powersOfTen[loop]);
+		digit = '0';
+		while (a_value >= power)
+		{
+			a_value -= power;
+			digit++;
+		}
+		/* no leading zeros */
+		if ((digit != '0') || (length != 0))
+		{
+			a_str_Ptr[length++] = digit;
+		}
+	}
+	a_str_Ptr[length++] = '0' + (uint8)a_value;
+	a_str_Ptr[length] = '\0';
+	return length;
+}
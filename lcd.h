@@ -88,27 +88,189 @@
 #define LCD_DISP_LENGTH		20							/**< visible characters per line			*/
 #define LCD_START_LINE1		0x00						/**< DDRAM address of first char of line 1	*/
 #define LCD_START_LINE2		0x40						/**< DDRAM address of first char of line 2	*/
-#define LCD_START_LINE3		0x10						/**< DDRAM address of first char of line 3	*/	
-#define LCD_START_LINE4		0x50						/**< DDRAM address of first char of line 4	*/
+#define LCD_START_LINE3		0x14						/**< DDRAM address of first char of line 3	*/	
+#define LCD_START_LINE4		0x54						/**< DDRAM address of first char of line 4	*/
+#define LCD_MAX_LINES		4							/**< maximum lines an Lcd instance can hold	*/
+#define LCD_MAX_LENGTH		40							/**< maximum characters per line of a frame	*/
+#define LCD_NUMBER_LENGTH	34							/**< sint32 in base 2, sign and terminator	*/
+#define LCD_FIXED_MAX_FRAC	9							/**< fraction digits of LCD_displayFixedInst*/
+#define LCD_NUMBER_OVERFLOW	'#'							/**< fills a number wider than its field	*/
+
+/*	40x4 modules have two controllers, the second one drives lines 3 and 4 and has its own enable line.
+*	To use such module as the default display define LCD_EN2_PORT and LCD_EN2_PIN, set LCD_DISP_LENGTH to 40
+*	and LCD_START_LINE3, LCD_START_LINE4 to 0x00 and 0x40, they are addresses inside the second controller
+*/
+/* #define LCD_EN2_PORT		'D' */						/**< port for Enable line of 2nd controller	*/
+/* #define LCD_EN2_PIN		 5	*/						/**< pin for Enable line of 2nd controller	*/
+
+/*	Each controller of an Lcd instance takes its queues in RAM, only one is kept unless g_lcd drives a 40x4
+*	module. Define LCD_MAX_CONTROLLERS to 2 before including lcd.h to give the second EN line of another
+*	instance with LCD_setEnablePin
+*/
+#ifndef LCD_MAX_CONTROLLERS
+#ifdef LCD_EN2_PIN
+#define LCD_MAX_CONTROLLERS	2							/**< maximum controllers of one Lcd instance*/
+#else
+#define LCD_MAX_CONTROLLERS	1							/**< maximum controllers of one Lcd instance*/
+#endif
+#endif
+
+/*	Writes are queued per controller and sent by a scheduler, while one controller executes a write the bus is
+*	free for another one. LCD_PENDING_DEPTH is the queue size of each controller, to overlap a full repaint of a
+*	40x4 module inside LCD_beginBatch/LCD_endBatch it should hold a whole line plus its address command, a
+*	smaller one only makes a batch wait sooner for a free entry
+*/
+#ifndef LCD_PENDING_DEPTH
+#define LCD_PENDING_DEPTH	16							/**< queued writes per controller			*/
+#endif
+
+/*	Each controller has two queues (lanes), the writes of the urgent lane are sent before the background ones at
+*	the next character boundary, and the background lane goes on from its own cursor address after them
+*	(LCD_URGENT_DEPTH can be defined before including lcd.h as LCD_PENDING_DEPTH)
+*/
+#ifndef LCD_URGENT_DEPTH
+#define LCD_URGENT_DEPTH	8							/**< queued urgent writes per controller	*/
+#endif
+#define LCD_LANE_BACKGROUND	0							/**< normal writes, full repaints			*/
+#define LCD_LANE_URGENT		1							/**< alarms, sent before background writes	*/
+#define LCD_LANES			2
+
+/*	The peephole optimizer looks at the last queued write of a lane before adding a new one: cursor locations,
+*	display controls and entry modes replace the queued one of the same kind or are dropped if the controller
+*	already has them, and spaces written on cells blank since the last clear only move the cursor.
+*	Set it to 0 to send the writes exactly as they are queued
+*/
+#ifndef LCD_PEEPHOLE
+#define LCD_PEEPHOLE		1
+#endif
+
+/*	Controller of the display, its datasheet timings are used by the initialization and the scheduler */
+#define LCD_CONTROLLER_HD44780	0						/**< Hitachi HD44780U, fosc 270kHz			*/
+#define LCD_CONTROLLER_KS0066	1						/**< Samsung KS0066U, fosc 270kHz			*/
+#define LCD_CONTROLLER_ST7066U	2						/**< Sitronix ST7066U, fosc 270kHz			*/
+#ifndef LCD_CONTROLLER
+#define LCD_CONTROLLER		LCD_CONTROLLER_HD44780
+#endif
+
+/*	Execution time of the instructions in micro seconds, the controller is busy for this time after the enable
+*	falling edge and can't accept a new write, the scheduler uses it as the controller busy deadline.
+*	The LCD_T_xxx_NS bus timings are the worst case over the supply range of the controller, they become cycle
+*	exact delays from F_CPU (see OSC_DELAY_NS) and no delay at all when the GPIO writes are slower than them.
+*	LCD_POWER_ON_MS is the time the controller needs after VDD rises before the first instruction, it is waited
+*	once by the first LCD_init, define it before including lcd.h if the power supply rises slowly (or to 40 for
+*	an HD44780 at 3V)
+*/
+#if (LCD_CONTROLLER == LCD_CONTROLLER_KS0066)
+#define LCD_T_SETUP_NS		60							/**< RS, RW setup before enable rises (tAS)	*/
+#define LCD_T_PULSE_NS		450							/**< enable high pulse width (PWEH)			*/
+#define LCD_T_CYCLE_NS		1000						/**< enable cycle time (tcycE)				*/
+#define LCD_T_READ_NS		360							/**< data out delay after enable rises (tDDR)*/
+#define LCD_T_DSW_NS		195							/**< data setup before enable falls (tDSW)	*/
+#define LCD_T_HOLD_NS		10							/**< data, RS, RW hold after enable falls (tH)*/
+#define LCD_EXEC_US			39							/**< most instructions						*/
+#define LCD_EXEC_DATA_US	43							/**< write data to DDRAM					*/
+#define LCD_EXEC_CLEAR_US	1530						/**< clear display and return home			*/
+#define LCD_POWER_ON_TYP_MS	30							/**< after VDD reaches 4.5V					*/
+#elif (LCD_CONTROLLER == LCD_CONTROLLER_ST7066U)
+#define LCD_T_SETUP_NS		0							/**< RS, RW setup before enable rises (tAS)	*/
+#define LCD_T_PULSE_NS		460							/**< enable high pulse width (PWEH)			*/
+#define LCD_T_CYCLE_NS		1200						/**< enable cycle time (tcycE)				*/
+#define LCD_T_READ_NS		400							/**< data out delay after enable rises (tDDR)*/
+#define LCD_T_DSW_NS		80							/**< data setup before enable falls (tDSW)	*/
+#define LCD_T_HOLD_NS		10							/**< data, RS, RW hold after enable falls (tH)*/
+#define LCD_EXEC_US			37							/**< most instructions						*/
+#define LCD_EXEC_DATA_US	41							/**< write data to DDRAM, 37us + tADD 4us	*/
+#define LCD_EXEC_CLEAR_US	1520						/**< clear display and return home			*/
+#define LCD_POWER_ON_TYP_MS	40							/**< after VDD reaches 4.5V					*/
+#else
+#define LCD_T_SETUP_NS		60							/**< RS, RW setup before enable rises (tAS)	*/
+#define LCD_T_PULSE_NS		450							/**< enable high pulse width (PWEH)			*/
+#define LCD_T_CYCLE_NS		1000						/**< enable cycle time (tcycE)				*/
+#define LCD_T_READ_NS		360							/**< data out delay after enable rises (tDDR)*/
+#define LCD_T_DSW_NS		195							/**< data setup before enable falls (tDSW)	*/
+#define LCD_T_HOLD_NS		10							/**< data, RS, RW hold after enable falls (tH)*/
+#define LCD_EXEC_US			37							/**< most instructions						*/
+#define LCD_EXEC_DATA_US	41							/**< write data to DDRAM, 37us + tADD 4us	*/
+#define LCD_EXEC_CLEAR_US	1520						/**< clear display and return home			*/
+#define LCD_POWER_ON_TYP_MS	15							/**< after VDD reaches 4.5V					*/
+#endif
+#ifndef LCD_POWER_ON_MS
+#define LCD_POWER_ON_MS		LCD_POWER_ON_TYP_MS
+#endif
+
+/*	With LCD_SLEEP_WAITS defined (lcd.c built with timer.c) the waits of at least LCD_SLEEP_MIN_US, the clear
+*	display and return home execution, the power-on and first reset waits, put the CPU in idle sleep till a
+*	Timer0 compare match instead of spinning and the other interrupts are serviced meanwhile. Timer0 must be
+*	started by TIMER0_init and the interrupts enabled, otherwise these waits spin as before
+*/
+/* #define LCD_SLEEP_WAITS */
+#ifndef LCD_SLEEP_MIN_US
+#define LCD_SLEEP_MIN_US	200							/**< shorter waits spin, a wake up costs more*/
+#endif
+
+/*	Waits of the initialization by instruction, after the first and the second function set 0x3 of the reset
+*	sequence, the interface is 8-bit then so they are a single nibble in 4-bit mode
+*/
+#define LCD_RESET1_US		4100						/**< after the first function set			*/
+#define LCD_RESET2_US		100							/**< after the second function set			*/
+
+/*	Time the bus is held by one write, one enable cycle for each nibble (4-bit mode) or byte (8-bit mode), the
+*	bus time counts it in whole micro seconds
+*/
+#define LCD_EN_PULSE_US		((LCD_T_CYCLE_NS + 999) / 1000)	/**< enable cycle in micro seconds		*/
+#define LCD_BUS_US			((8 / LCD_IO_MODE) * LCD_EN_PULSE_US)
+
+/*	Default cost of one data write and one command of the GPIO transport, used by the frame planner to choose
+*	between re-sending unchanged cells and sending a cursor location command, see LCD_setCostInst
+*/
+#define LCD_COST_DATA_US	(LCD_BUS_US + LCD_EXEC_DATA_US)
+#define LCD_COST_CMD_US		(LCD_BUS_US + LCD_EXEC_US)
+
+/*	A display without RAM for a frame can keep a CRC-8 of each span of LCD_CRC_SPAN characters of a line instead,
+*	the render pass re-sends only the spans which changed, see LCD_renderBeginInst. LCD_CRC_SEGMENTS covers the
+*	LCD_LINES x LCD_DISP_LENGTH display, spans after the first LCD_CRC_SEGMENTS ones (line by line) are not hashed
+*	and always sent. RAM cost: 2 * LCD_CRC_SEGMENTS + 6 bytes, 38 bytes for 20x4, 22 bytes for 16x2
+*/
+#define LCD_CRC_SPAN		5							/**< characters per hashed span				*/
+#ifndef LCD_CRC_SEGMENTS
+#define LCD_CRC_SEGMENTS	(LCD_LINES * ((LCD_DISP_LENGTH + LCD_CRC_SPAN - 1) / LCD_CRC_SPAN))
+#endif
+
+/*	passes of a render, see LCD_renderBeginInst */
+#define LCD_RENDER_OFF		0							/**< not inside a render					*/
+#define LCD_RENDER_HASH		1							/**< hash the drawn characters				*/
+#define LCD_RENDER_EMIT		2							/**< send the characters of changed spans	*/
 
 /*	function set: set interface data length and number of display lines */
 #define LCD_FUNCTION_4BIT_1LINE		0x20				/**< 4-bit interface, single line, 5x7 dots */
 #define LCD_FUNCTION_4BIT_2LINES	0x28				/**< 4-bit interface, dual line,   5x7 dots */
 #define LCD_FUNCTION_2_LINES		0x02				
+#define LCD_FUNCTION_RESET			0x30				/**< 8-bit interface, reset sequence		*/
+#define LCD_FUNCTION_4BIT			0x20				/**< 4-bit interface, sent as one nibble	*/
 #define LCD_FUNCTION_8BIT_1LINE		0x30				/**< 8-bit interface, single line, 5x7 dots */
 #define LCD_FUNCTION_8BIT_2LINES	0x38				/**< 8-bit interface, dual line,   5x7 dots */
+#define LCD_FUNCTION_LINES_BIT		0x08				/**< N bit of the function set, dual line	*/
 
 /*	instruction register bit positions */
 #define LCD_CLR						0x01				/**< clear display, (also clear DDRAM content) */
 #define LCD_CURSOR_OFF				0x0C				/**< Display on Cursor off					*/
 #define LCD_CURSOR_ON				0x0E				/**< Display on Cursor on					*/
 #define SET_CURSOR_LOCATION			0x80				/**< Set DDRAM address or cursor position on display */
+#define LCD_SET_CGRAM_ADDRESS		0x40				/**< Set CGRAM address, character * 8 + row	*/
+
+/*	custom characters: 8 rows of 5 dots each, the codes 0x08-0x0F show them as 0x00-0x07 do but they can be
+*	in a string since they are not the terminator
+*/
+#define LCD_GLYPHS					8					/**< custom characters of the CGRAM			*/
+#define LCD_GLYPH_ROWS				8					/**< rows of a custom character				*/
+#define LCD_GLYPH_CODE				0x08				/**< code of the first custom character		*/
 
 /* set entry mode: display shift on/off, dec/inc cursor move direction */
 #define LCD_ENTRY_DEC				0x04				/**< display shift off, dec cursor move dir */
 #define LCD_ENTRY_DEC_SHIFT			0x05				/**< display shift on,  dec cursor move dir */
 #define LCD_ENTRY_INC				0x06				/**< display shift off, inc cursor move dir */
 #define LCD_ENTRY_INC_SHIFT			0x07				/**< display shift on,  inc cursor move dir */
+#define LCD_ENTRY_SHIFT_BIT			0x01				/**< entry mode bit of the display shift	*/
 
 /*	display on/off, cursor on/off, blinking char at cursor position */
 #define LCD_DISP_OFF				0x08				/**< display off                            */
@@ -140,103 +302,822 @@
 	#endif
 #endif
 
+/*-------------------------------------- Structures and Unions ---------------------------------------*/
+/* ---------------------------------------------------------------------------------------------------
+[Structure Name]: LcdXfer
+[Structure Description]: This structure describes one queued write to a controller:
+								1. s_data: the command or data byte
+								2. s_type: LCD_XFER_CMD or LCD_XFER_DATA
+---------------------------------------------------------------------------------------------------- */
+typedef struct
+{
+	/* s_data is the byte to be written to the controller */
+	uint8 s_data;
+	/* s_type is LCD_XFER_CMD for the instruction register or LCD_XFER_DATA for the data register */
+	uint8 s_type;
+}LcdXfer;
+
+#define LCD_XFER_CMD	0
+#define LCD_XFER_DATA	1
+
+/*	results of LCD_warmInitInst */
+#define LCD_START_COLD	0
+#define LCD_START_WARM	1
+
+/*	results of LCD_scrubInst */
+#define LCD_SCRUB_CLEAN		0							/**< the checked cells are right			*/
+#define LCD_SCRUB_REPAIRED	1							/**< corrupted cells are written again		*/
+#define LCD_SCRUB_REINIT	2							/**< the display is initialized again		*/
+#define LCD_SCRUB_SKIPPED	3							/**< no frame, or writes not sent yet		*/
+
+/*	busy flag in the byte read with RS low, the other bits are the address counter */
+#define LCD_BUSY_FLAG	0x80
+
+/*	warm start probe: last DDRAM address of the first line, and the address which follows it with one line (N=0)
+*	or two lines (N=1) set by the function set command
+*/
+#define LCD_PROBE_ADDRESS		0x27
+#define LCD_PROBE_NEXT_1LINE	0x28
+#define LCD_PROBE_NEXT_2LINE	0x40
+
+/*	direction of the text, see LCD_setDirectionInst */
+#define LCD_DIRECTION_KEEP		0							/**< the entry mode is set by the application	*/
+#define LCD_DIRECTION_LTR		1							/**< left to right, increment entry mode		*/
+#define LCD_DIRECTION_RTL		2							/**< right to left, decrement entry mode		*/
+
+/*	value of an address counter which is not known, after writing to the CGRAM for example */
+#define LCD_ADDRESS_UNKNOWN		0xFF
+
+/*	logical column of a right to left text which passed column 0, its next characters are dropped */
+#define LCD_COL_PAST_START		0xFF
+
+/* ---------------------------------------------------------------------------------------------------
+[Structure Name]: LcdLane
+[Structure Description]: This structure describes one queue (lane) of a controller:
+								1. s_head, s_count: the oldest queued write and the number of queued writes
+								2. s_address: DDRAM address the next data byte of this lane is written to, the
+								   scheduler moves the cursor back to it if the other lane moved it
+---------------------------------------------------------------------------------------------------- */
+typedef struct
+{
+	uint8 s_head;
+	uint8 s_count;
+	uint8 s_address;
+}LcdLane;
+
+/* ---------------------------------------------------------------------------------------------------
+[Structure Name]: LcdMode
+[Structure Description]: This structure is the state of a controller followed by the driver, LCD_ADDRESS_UNKNOWN
+						 in a field means it is not known:
+								1. s_address: the DDRAM address counter
+								2. s_entryMode, s_dispCtrl: the last entry mode and display on/off control commands
+								3. s_writtenLo, s_writtenHi: lowest and highest DDRAM address written since the
+								   last clear, the other cells are blank (s_writtenLo > s_writtenHi if none is
+								   written, s_writtenLo is LCD_ADDRESS_UNKNOWN if the content is not known)
+---------------------------------------------------------------------------------------------------- */
+typedef struct
+{
+	uint8 s_address;
+	uint8 s_entryMode;
+	uint8 s_dispCtrl;
+	uint8 s_writtenLo;
+	uint8 s_writtenHi;
+}LcdMode;
+
+/* ---------------------------------------------------------------------------------------------------
+[Structure Name]: LcdController
+[Structure Description]: This structure describes one HD44780 controller of a display, a 40x4 module has two
+						 of them sharing the data and RS/RW lines:
+								1. s_en: the enable pin of this controller
+								2. s_deadline: bus time in micro seconds when the controller finishes the last write
+								3. s_mode: the state of the controller after the last write
+								4. s_tail, s_tailUndo: the state after the queued writes and, if the last queued
+								   write is a cursor location, display control or entry mode, the command it replaced
+								5. s_lane, s_pending, s_urgent: the background and urgent queues of writes not sent yet
+---------------------------------------------------------------------------------------------------- */
+typedef struct
+{
+	/* s_en is the enable pin of this controller */
+	DioConfig s_en;
+	/* s_deadline is the bus time when the controller is not busy anymore */
+	uint16 s_deadline;
+	/* s_mode is the address counter, entry mode, display control and blank cells of the controller */
+	LcdMode s_mode;
+	/* s_tail is s_mode after the queued writes, it is used by the peephole optimizer and the right to left text */
+	LcdMode s_tail;
+	uint8 s_tailUndo;
+	/* s_lane is the state of the background and urgent queues */
+	LcdLane s_lane[LCD_LANES];
+	/* s_pending and s_urgent are the circular queues of the background and urgent lanes */
+	LcdXfer s_pending[LCD_PENDING_DEPTH];
+	LcdXfer s_urgent[LCD_URGENT_DEPTH];
+}LcdController;
+
+/* ---------------------------------------------------------------------------------------------------
+[Structure Name]: LcdFrame
+[Structure Description]: This structure is the frame buffer of one display, when it is attached to the display the
+						 LCD_xxx functions only draw in it and the changed cells are written later by LCD_service
+						 or LCD_flushInst:
+								1. s_front: the characters on the display (written or queued already)
+								2. s_back: the characters drawn by the application
+								3. s_dirty: bit for each line which may have cells where s_back is not s_front
+								4. s_row, s_col: the logical cursor of the drawing functions
+								5. s_nextRow, s_nextCol: for each controller the cell its cursor is on after the
+								   queued writes, s_nextRow is LCD_ADDRESS_UNKNOWN if not known
+								6. s_hold: 1 between LCD_beginFrameInst and LCD_commitFrameInst, the changed cells
+								   are not written meanwhile
+---------------------------------------------------------------------------------------------------- */
+typedef struct
+{
+	uint8 s_front[LCD_MAX_LINES][LCD_MAX_LENGTH];
+	uint8 s_back[LCD_MAX_LINES][LCD_MAX_LENGTH];
+	uint8 s_dirty;
+	uint8 s_row;
+	uint8 s_col;
+	uint8 s_nextRow[LCD_MAX_CONTROLLERS];
+	uint8 s_nextCol[LCD_MAX_CONTROLLERS];
+	uint8 s_hold;
+}LcdFrame;
+
+/* ---------------------------------------------------------------------------------------------------
+[Structure Name]: LcdCrcFrame
+[Structure Description]: This structure is the low RAM alternative of LcdFrame, it keeps a CRC-8 of each span of
+						 the display instead of its characters:
+								1. s_hash: CRC of each span sent to the display by the last render
+								2. s_work: CRC of each span drawn by the current render
+								3. s_pass: LCD_RENDER_OFF, LCD_RENDER_HASH or LCD_RENDER_EMIT
+								4. s_flags: LCD_CRC_VALID, LCD_CRC_CLEARED and LCD_CRC_UNHASHED bits
+								5. s_row, s_col: the logical cursor of the drawing functions
+								6. s_nextRow, s_nextCol: the cell the controller cursor is on, s_nextRow is
+								   LCD_ADDRESS_UNKNOWN if not known
+---------------------------------------------------------------------------------------------------- */
+typedef struct
+{
+	uint8 s_hash[LCD_CRC_SEGMENTS];
+	uint8 s_work[LCD_CRC_SEGMENTS];
+	uint8 s_pass;
+	uint8 s_flags;
+	uint8 s_row;
+	uint8 s_col;
+	uint8 s_nextRow;
+	uint8 s_nextCol;
+}LcdCrcFrame;
+
+#define LCD_CRC_VALID		0x01						/**< s_hash is what the display shows		*/
+#define LCD_CRC_CLEARED		0x02						/**< the render cleared the screen			*/
+#define LCD_CRC_UNHASHED	0x04						/**< the render drew after the hashed spans	*/
+
+/* ---------------------------------------------------------------------------------------------------
+[Structure Name]: LcdStats
+[Structure Description]: This structure holds the counters of one display, they wrap around when they overflow:
+								1. s_dataWrites, s_cmdWrites: data bytes and commands sent to the controllers
+								2. s_runs: runs of changed frame cells written, a run starts at a changed cell
+								   which is not right after the last written cell
+								3. s_addressCmds: runs started with a cursor location command
+								4. s_joinedRuns, s_resentCells: runs joined to the cursor by re-sending the
+								   unchanged cells before them, and the number of these cells
+								5. s_continuedRuns: runs started where the cursor already is, at the next line
+								   in the DDRAM for example
+								6. s_savedUs: time saved by the planner compared with one cursor location
+								   command for each run
+								7. s_peepholeDrops: queued writes removed by the peephole optimizer
+								8. s_scrubRepairs, s_scrubResets: corrupted cells written again and displays
+								   initialized again by LCD_scrubInst
+---------------------------------------------------------------------------------------------------- */
+typedef struct
+{
+	uint16 s_dataWrites;
+	uint16 s_cmdWrites;
+	uint16 s_runs;
+	uint16 s_addressCmds;
+	uint16 s_joinedRuns;
+	uint16 s_resentCells;
+	uint16 s_continuedRuns;
+	uint32 s_savedUs;
+	uint16 s_peepholeDrops;
+	uint16 s_scrubRepairs;
+	uint16 s_scrubResets;
+}LcdStats;
+
+/* ---------------------------------------------------------------------------------------------------
+[Structure Name]: Lcd
+[Structure Description]: This structure is the handle of one lcd display, it holds the pin map, the geometry
+						 and the state of this display, so many displays can be driven at the same time.
+						 Displays can share the data bus and the RS/RW lines and only have a separate EN line,
+						 in this case just give them the same data and RS/RW pins:
+								1. s_data: the data pins, D0-D7 in 8-bit mode or D4-D7 in 4-bit mode
+								2. s_rs, s_rw: the control pins
+								3. s_ctrl, s_controllers: the controllers with their EN pins and write queues
+								4. s_lines, s_length: number of lines and visible characters per line
+								5. s_lineStart, s_lineCtrl: DDRAM address of the first character of each line
+								   and the controller which drives this line
+								6. s_dispCtrl: the last display on/off control command sent to the display
+								7. s_lane, s_activeCtrl: the lane used by the next writes and for each lane the
+								   controller which receives the data characters
+								8. s_frame_Ptr: the frame buffer of the display or 0 if the display is written
+								   directly
+								   s_crc_Ptr: the span CRCs of a display without frame, or 0
+								9. s_dataCost, s_cmdCost: cost in micro seconds of a data write and a command
+								10. s_stats: the counters of the display, see LCD_getStatsInst
+								11. s_next: next display in the list the scheduler goes through
+								12. s_scrubRow, s_scrubCol: next cell checked by LCD_scrubInst
+								13. s_direction, s_entryMode: the text direction and the entry mode after the
+								    queued writes, LCD_ADDRESS_UNKNOWN if not known
+								14. s_rtlEnd: 1 once a right to left text written directly passed column 0
+---------------------------------------------------------------------------------------------------- */
+typedef struct Lcd
+{
+	/* s_data is the data pins, index 0 is D0 in 8-bit mode or D4 in 4-bit mode */
+	DioConfig s_data[LCD_IO_MODE];
+	/* s_rs is the register select pin: LOGIC_LOW for command, LOGIC_HIGH for data */
+	DioConfig s_rs;
+	/* s_rw is the read/write pin: LOGIC_LOW for write, LOGIC_HIGH for read */
+	DioConfig s_rw;
+	/* s_ctrl is the controllers of this display, each one with its own enable pin */
+	LcdController s_ctrl[LCD_MAX_CONTROLLERS];
+	/* s_controllers is the number of used controllers: [1-LCD_MAX_CONTROLLERS] */
+	uint8 s_controllers;
+	/* s_lines is the number of lines of the display: [1-LCD_MAX_LINES] */
+	uint8 s_lines;
+	/* s_length is the number of visible characters per line */
+	uint8 s_length;
+	/* s_lineStart is the DDRAM address of first character of each line */
+	uint8 s_lineStart[LCD_MAX_LINES];
+	/* s_lineCtrl is the index of the controller which drives each line */
+	uint8 s_lineCtrl[LCD_MAX_LINES];
+	/* s_dispCtrl is the display on/off control command, LCD_CURSOR_OFF or LCD_CURSOR_ON for example */
+	uint8 s_dispCtrl;
+	/* s_lane is the lane of the next writes, LCD_LANE_BACKGROUND or LCD_LANE_URGENT */
+	uint8 s_lane;
+	/* s_activeCtrl is the controller addressed by the last LCD_goToRowColumnInst of each lane */
+	uint8 s_activeCtrl[LCD_LANES];
+	/* s_frame_Ptr is the attached frame buffer, see LCD_attachFrameInst */
+	LcdFrame* s_frame_Ptr;
+	/* s_crc_Ptr is the attached span CRCs, see LCD_attachCrcFrameInst */
+	LcdCrcFrame* s_crc_Ptr;
+	/* s_dataCost and s_cmdCost are the costs used by the frame planner, see LCD_setCostInst */
+	uint16 s_dataCost;
+	uint16 s_cmdCost;
+	/* s_stats is the counters of the display */
+	LcdStats s_stats;
+	/* s_next is the next initialized display, the scheduler goes through all of them */
+	struct Lcd* s_next;
+	/* s_scrubRow and s_scrubCol are the next cell read back by LCD_scrubInst */
+	uint8 s_scrubRow;
+	uint8 s_scrubCol;
+	/* s_direction is LCD_DIRECTION_KEEP, LCD_DIRECTION_LTR or LCD_DIRECTION_RTL, see LCD_setDirectionInst */
+	uint8 s_direction;
+	/* s_entryMode is the last entry mode given to the queues, the entry mode command is sent when it changes */
+	uint8 s_entryMode;
+	/* s_rtlEnd is 1 when the next right to left characters are dropped, a cursor location, clear or home resets it */
+	uint8 s_rtlEnd;
+}Lcd;
+
+/*	LCD_PIN_INIT is used to fill a pin of an Lcd structure at compile time, for example:
+*	Lcd lcd2 = {{LCD_PIN_INIT('A',2), ..}, LCD_PIN_INIT('C',0), ..};
+*/
+#define LCD_PIN_INIT(PORT, PIN)		{(PORT), (PIN), OUTPUT, LOGIC_LOW}
+
+/*	Index of the lines of a 40x4 module geometry, the second controller starts at this line */
+#define LCD_SECOND_CTRL_LINE		2
+
+/*--------------------------------------- GLOBAL VARIABLES ---------------------------------------------*/
+/*	g_lcd is the default display, it is filled at compile time from the LCD_xxx_PORT/LCD_xxx_PIN and display
+*	size definitions above, so using the old singleton functions below costs nothing more than before
+*/
+EXTERN Lcd g_lcd;
+
 /*----------------------------------- FUNCTION DECLARATIONS ----------------------------------------------------*/
 /* ---------------------------------------------------------------------------------------------------------------
-[Function Name] : LCD_init
-[Description] :	This function is responsible for initialize the lcd data and control pins by call the static function
-				"LCD_configurations" which Fill the LCD Configuration structure for both data and control pins and 
-				initialize them with initial values, Prepare LCD to understand the 4-bit mode or 8-bit mode and set
-				cursor ON/OFF state and clear the LCD.
+[Function Name] : LCD_setDataPin
+[Description] :	This function is responsible for setting the port and pin number of one data line of a display
 				
 [Args] :
-[in] a_cursorState:
+[in] Lcd* a_lcd_Ptr, uint8 a_bit, uint8 a_lcdPort, uint8 a_lcdPin:
+a_lcd_Ptr: pointer to the display handle
+a_bit: index of the data line, [0-7] D0-D7 in 8-bit mode or [0-3] for D4-D7 in 4-bit mode
+a_lcdPort: PORT Which the line is connect with: 'A 'B' 'C' or 'D'
+a_lcdPin: Pin number in the PORT: [0-7]
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+EXTERN void LCD_setDataPin(Lcd* a_lcd_Ptr, uint8 a_bit, uint8 a_lcdPort, uint8 a_lcdPin);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_setControlPins
+[Description] :	This function is responsible for setting the port and pin number of the RS, RW and EN lines of a 
+				display
+				
+[Args] :
+[in] Lcd* a_lcd_Ptr, uint8 a_rsPort, uint8 a_rsPin, uint8 a_rwPort, uint8 a_rwPin, uint8 a_enPort, uint8 a_enPin:
+a_lcd_Ptr: pointer to the display handle
+a_rsPort, a_rsPin: port and pin of the RS line
+a_rwPort, a_rwPin: port and pin of the RW line
+a_enPort, a_enPin: port and pin of the EN line
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+EXTERN void LCD_setControlPins(Lcd* a_lcd_Ptr, uint8 a_rsPort, uint8 a_rsPin, uint8 a_rwPort, uint8 a_rwPin,
+							   uint8 a_enPort, uint8 a_enPin);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_setEnablePin
+[Description] :	This function is responsible for setting the port and pin number of the EN line of one controller
+				of a display, it is used for the second controller of a 40x4 module
+				
+[Args] :
+[in] Lcd* a_lcd_Ptr, uint8 a_ctrl, uint8 a_enPort, uint8 a_enPin:
+a_lcd_Ptr: pointer to the display handle
+a_ctrl: index of the controller [0-LCD_MAX_CONTROLLERS-1]
+a_enPort, a_enPin: port and pin of the EN line
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+EXTERN void LCD_setEnablePin(Lcd* a_lcd_Ptr, uint8 a_ctrl, uint8 a_enPort, uint8 a_enPin);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_shareBus
+[Description] :	This function is responsible for making a display use the same data, RS and RW lines of another 
+				display, and only give it its own EN line
+				
+[Args] :
+[in] Lcd* a_lcd_Ptr, const Lcd* a_busOwner_Ptr, uint8 a_enPort, uint8 a_enPin:
+a_lcd_Ptr: pointer to the display handle to be configured
+a_busOwner_Ptr: pointer to the display which its data and RS/RW lines are shared
+a_enPort, a_enPin: port and pin of the EN line of a_lcd_Ptr
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+EXTERN void LCD_shareBus(Lcd* a_lcd_Ptr, const Lcd* a_busOwner_Ptr, uint8 a_enPort, uint8 a_enPin);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_setGeometry
+[Description] :	This function is responsible for setting the number of lines and characters per line of a display
+				and calculate the DDRAM address of the first character of each line, lines 3 and 4 start right
+				after the end of lines 1 and 2.
+				If the display has more than 80 characters (40x4) it has two controllers, lines 3 and 4 are driven 
+				by the second one and start at the same addresses of lines 1 and 2, its enable pin is set by
+				LCD_setEnablePin (LCD_MAX_CONTROLLERS must then be 2)
+				
+[Args] :
+[in] Lcd* a_lcd_Ptr, uint8 a_lines, uint8 a_length:
+a_lcd_Ptr: pointer to the display handle
+a_lines: number of lines [1-LCD_MAX_LINES]
+a_length: visible characters per line
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+EXTERN void LCD_setGeometry(Lcd* a_lcd_Ptr, uint8 a_lines, uint8 a_length);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_initInst
+[Description] :	This function is responsible for initialize the lcd data and control pins of a display by setting 
+				their direction, Prepare LCD to understand the 4-bit mode or 8-bit mode and set cursor ON/OFF state
+				and clear the LCD.
+				
+[Args] :
+[in] Lcd* a_lcd_Ptr, uint8 a_cursorState:
+a_lcd_Ptr: pointer to the display handle
 a_cursorState is uint8 for the cursor state, LCD_CURSOR_OFF or LCD_CURSOR_ON
 [Returns] : This function return void
 --------------------------------------------------------------------------------------------------------------- */
-EXTERN void LCD_init(uint8 a_cursorState);
+EXTERN void LCD_initInst(Lcd* a_lcd_Ptr, uint8 a_cursorState);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_warmInitInst
+[Description] :	This function is responsible for initializing a display without clearing it if the controller is
+				still configured, after a watchdog or brown-out reset of the MCU for example. The busy flag and 
+				address counter are read through RW, first twice before any write: they must be the same, not
+				busy and a DDRAM address of the lines (a cursor left in the CGRAM starts cold). Then the cursor
+				is set to the last address of the first line and one character is read, the address counter
+				must then be at the first address of the second line
+				(or the next one for a single line display), which proves the controller is alive, in the same 
+				interface mode and number of lines. If it is, the display on/off control is sent and the DDRAM 
+				is read back into the attached frame, so the next drawing only writes what changed. Otherwise 
+				the display is initialized by LCD_initInst. The RW line must be connected to the MCU
+				
+[Args] :
+[in] Lcd* a_lcd_Ptr, uint8 a_cursorState:
+a_lcd_Ptr: pointer to the display handle
+a_cursorState is uint8 for the cursor state, LCD_CURSOR_OFF or LCD_CURSOR_ON
+[Returns] : LCD_START_WARM if the display is kept as it is, or LCD_START_COLD if it is initialized and cleared
+--------------------------------------------------------------------------------------------------------------- */
+EXTERN uint8 LCD_warmInitInst(Lcd* a_lcd_Ptr, uint8 a_cursorState);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_scrubInst
+[Description] :	This function is responsible for healing a display corrupted by noise, it is called from the main
+				loop. Each call reads back a_cells DDRAM cells through RW, compares them with the front buffer of
+				the attached frame and writes again only the corrupted ones, the next call goes on with the next
+				cells. After each read the busy flag and address counter are checked, a controller out of nibble
+				sync or in another mode answers at the wrong address. Each sweep of the screen starts by sending
+				again the display control and entry mode and the warm start probe of the number of lines. If a
+				check fails the display is initialized again and its frame written again.
+				A corrupted cell is repaired at most (lines * length / a_cells) calls after the corruption, the
+				call is skipped while the display has writes not sent yet or a frame being composed. The RW line
+				must be connected to the MCU
+				
+[Args] :
+[in] Lcd* a_lcd_Ptr, uint8 a_cells:
+a_lcd_Ptr: pointer to the display handle, it must have a frame
+a_cells: number of cells checked by this call, each one costs a cursor location command at most and two reads
+[Returns] : LCD_SCRUB_CLEAN, LCD_SCRUB_REPAIRED, LCD_SCRUB_REINIT or LCD_SCRUB_SKIPPED
+--------------------------------------------------------------------------------------------------------------- */
+EXTERN uint8 LCD_scrubInst(Lcd* a_lcd_Ptr, uint8 a_cells);
 
 /* ---------------------------------------------------------------------------------------------------------------
-[Function Name] : LCD_sendCommand
+[Function Name] : LCD_sendCommandInst
 [Description] : This function is responsible for sending command to the lcd, it call the LCD_write function which
 				takes two parameters, 1st the data to be sent to LCD, and the data type whether it's a data character 
-				or a command byte, so we call LCD_write and send 0 to indicate that it's a command
+				or a command byte, so we call LCD_write and send LCD_XFER_CMD to indicate that it's a command
 				
 [Args] :
-[in] uint8 a_command:
-The command to be executed in the LCD
+[in] Lcd* a_lcd_Ptr, uint8 a_command:
+a_lcd_Ptr: pointer to the display handle
+a_command: The command to be executed in the LCD
 [Returns] : This function return void
 --------------------------------------------------------------------------------------------------------------- */
-EXTERN void LCD_sendCommand(uint8 a_command);
+EXTERN void LCD_sendCommandInst(Lcd* a_lcd_Ptr, uint8 a_command);
 
 /* ---------------------------------------------------------------------------------------------------------------
-[Function Name] : LCD_displayCharacter
+[Function Name] : LCD_broadcastCommand
+[Description] : This function is responsible for sending the same command to many displays which share the same data
+				and RS/RW lines, the data lines are prepared once for each nibble and then the EN line of every
+				controller of every display is toggled, so clearing or configuring N displays costs one bus setup 
+				instead of N.
+				The queued writes are sent first and the command is sent when all the controllers are not busy
+				
+[Args] :
+[in] Lcd* const* a_lcds_Ptr, uint8 a_count, uint8 a_command:
+a_lcds_Ptr: array of pointers to the display handles, all of them must share the data and RS/RW lines
+a_count: number of displays in the array
+a_command: The command to be executed in the displays
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+EXTERN void LCD_broadcastCommand(Lcd* const* a_lcds_Ptr, uint8 a_count, uint8 a_command);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_flushInst
+[Description] : This function is responsible for sending all the queued writes of a display, the scheduler sends the
+				queued writes of all the controllers on the bus in the order of their busy deadlines, so while a 
+				controller executes a write the bus is used to write to another one
+				
+[Args] :
+[in] Lcd* a_lcd_Ptr:
+a_lcd_Ptr: pointer to the display handle
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+EXTERN void LCD_flushInst(Lcd* a_lcd_Ptr);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_flushAll
+[Description] : This function is responsible for sending all the queued writes of all the initialized displays
+				
+[Args] :
+[in] void:
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+EXTERN void LCD_flushAll(void);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_beginBatch
+[Description] : This function is responsible for starting a batch, by default every LCD_xxx function sends its writes
+				before it returns, inside a batch the writes are only queued (and sent when a queue is full), so the
+				writes of different controllers or displays are overlapped when the batch ends.
+				Batches can be nested, the writes are sent by the last LCD_endBatch
+				
+[Args] :
+[in] void:
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+EXTERN void LCD_beginBatch(void);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_endBatch
+[Description] : This function is responsible for ending a batch started by LCD_beginBatch and sending all the queued
+				writes of all displays
+				
+[Args] :
+[in] void:
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+EXTERN void LCD_endBatch(void);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_setLaneInst
+[Description] : This function is responsible for choosing the lane of the next writes of a display, the urgent writes
+				are sent before the queued background writes at the next character boundary, even during a long 
+				flush of a background repaint if they are queued by the preempt hook, see LCD_setPreemptHook
+				
+[Args] :
+[in] Lcd* a_lcd_Ptr, uint8 a_lane:
+a_lcd_Ptr: pointer to the display handle
+a_lane: LCD_LANE_BACKGROUND or LCD_LANE_URGENT
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+EXTERN void LCD_setLaneInst(Lcd* a_lcd_Ptr, uint8 a_lane);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_setPreemptHook
+[Description] : This function is responsible for setting a function called by the scheduler before each write it 
+				sends, the hook can queue urgent writes (draining an LcdQueue of alarms for example) which are then
+				sent before the rest of the background writes. The hook runs like a batch, its writes are only
+				queued, and it is not called again while it runs
+				
+[Args] :
+[in] void (*a_hook_Ptr)(void):
+a_hook_Ptr: pointer to the hook function, or 0 to remove it
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+EXTERN void LCD_setPreemptHook(void (*a_hook_Ptr)(void));
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_attachFrameInst
+[Description] :	This function is responsible for attaching a frame buffer to a display, it must be called before
+				LCD_initInst. The drawing functions (character, string, number, go to, clear) of a display with a
+				frame never block, they only change the frame and the changed cells are written by LCD_service
+				or LCD_flushInst. LCD_sendCommandInst still queues its command, it is sent by the same functions
+				
+[Args] :
+[in] Lcd* a_lcd_Ptr, LcdFrame* a_frame_Ptr:
+a_lcd_Ptr: pointer to the display handle
+a_frame_Ptr: pointer to the frame buffer, or 0 to write the display directly again
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+EXTERN void LCD_attachFrameInst(Lcd* a_lcd_Ptr, LcdFrame* a_frame_Ptr);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_beginFrameInst
+[Description] :	This function is responsible for starting the composition of the next screen of a display with a
+				frame. The drawing functions keep changing the back buffer only, but LCD_service and LCD_flushInst
+				don't write its changed cells till LCD_commitFrameInst, so a half drawn screen is never shown.
+				A clear screen inside the frame only fills the back buffer with spaces, the screen is redrawn
+				without the clear display command and its flicker:
+					LCD_beginFrame();
+					LCD_clearScreen();
+					LCD_displayStringRowColumn(0, 0, "Temp:");
+					LCD_displayNumber(temp, 10);
+					LCD_commitFrame();
+				Commands sent by LCD_sendCommandInst are still queued and written as before
+				
+[Args] :
+[in] Lcd* a_lcd_Ptr:
+a_lcd_Ptr: pointer to the display handle, it does nothing if the display has no frame
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+EXTERN void LCD_beginFrameInst(Lcd* a_lcd_Ptr);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_commitFrameInst
+[Description] :	This function is responsible for ending the composition started by LCD_beginFrameInst, the cells of
+				the back buffer which are not the front buffer are written in one burst by LCD_flushInst, in the
+				DDRAM order chosen by the frame planner
+				
+[Args] :
+[in] Lcd* a_lcd_Ptr:
+a_lcd_Ptr: pointer to the display handle, it does nothing if the display has no frame
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+EXTERN void LCD_commitFrameInst(Lcd* a_lcd_Ptr);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_service
+[Description] :	This function is responsible for writing the queued writes and the changed frame cells of all the
+				displays for a limited time, it is called from a cooperative main loop instead of a blocking 
+				repaint. A write is sent only if the wait for its controller and the bus time of the write fit in
+				what is left of the budget. If the next controller is busy for longer than what is left (after a
+				clear display for example) the rest of the budget is spent waiting, so the next call can go on.
+				The time is counted by the bus clock of the driver, the time spent in the preempt hook is not in
+				the budget
+				
+[Args] :
+[in] uint16 a_budget_us:
+a_budget_us: the time in micro seconds the call can spend, it must be more than LCD_BUS_US to send anything
+[Returns] : The number of queued writes and changed frame cells not written yet, 0 when everything is written
+--------------------------------------------------------------------------------------------------------------- */
+EXTERN uint16 LCD_service(uint16 a_budget_us);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_setCostInst
+[Description] :	This function is responsible for setting the cost of one data write and one command of the transport
+				of a display. When the frame is written the planner re-sends the unchanged cells between the cursor
+				and the next changed cell if they cost less than a cursor location command. LCD_initInst sets
+				LCD_COST_DATA_US and LCD_COST_CMD_US if no cost is set
+				
+[Args] :
+[in] Lcd* a_lcd_Ptr, uint16 a_dataUs, uint16 a_cmdUs:
+a_lcd_Ptr: pointer to the display handle
+a_dataUs: time in micro seconds of one data write
+a_cmdUs: time in micro seconds of one command
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+EXTERN void LCD_setCostInst(Lcd* a_lcd_Ptr, uint16 a_dataUs, uint16 a_cmdUs);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_getStatsInst
+[Description] :	This function is responsible for copying the counters of a display, they show the writes sent and
+				what the frame planner decided
+				
+[Args] :
+[in] const Lcd* a_lcd_Ptr:
+a_lcd_Ptr: pointer to the display handle
+[out] LcdStats* a_stats_Ptr:
+a_stats_Ptr: the copy of the counters
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+EXTERN void LCD_getStatsInst(const Lcd* a_lcd_Ptr, LcdStats* a_stats_Ptr);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_clearStatsInst
+[Description] :	This function is responsible for setting all the counters of a display to zero
+				
+[Args] :
+[in] Lcd* a_lcd_Ptr:
+a_lcd_Ptr: pointer to the display handle
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+EXTERN void LCD_clearStatsInst(Lcd* a_lcd_Ptr);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_attachCrcFrameInst
+[Description] :	This function is responsible for attaching span CRCs to a display which has no frame, the display
+				is written directly as before outside a render
+				
+[Args] :
+[in] Lcd* a_lcd_Ptr, LcdCrcFrame* a_crc_Ptr:
+a_lcd_Ptr: pointer to the display handle
+a_crc_Ptr: pointer to the span CRCs, or 0 to remove them
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+EXTERN void LCD_attachCrcFrameInst(Lcd* a_lcd_Ptr, LcdCrcFrame* a_crc_Ptr);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_renderBeginInst
+[Description] :	This function is responsible for starting a render pass of a display with span CRCs. The application
+				draws the whole screen with the usual functions between LCD_renderBeginInst and LCD_renderEndInst
+				in a loop:
+					do
+					{
+						LCD_renderBegin();
+						LCD_displayStringRowColumn(0, 0, "Temp:");
+						LCD_displayNumber(temp, 10);
+					} while (LCD_renderEnd());
+				The first pass only hashes the drawn characters, if a span changed LCD_renderEndInst returns 1 and
+				the second pass sends the characters of the changed spans only. The same characters must be drawn
+				by both passes, and the cells which are not drawn keep what they show. A clear screen inside the
+				render clears the display before the second pass if anything changed
+				
+[Args] :
+[in] Lcd* a_lcd_Ptr:
+a_lcd_Ptr: pointer to the display handle, it must have span CRCs
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+EXTERN void LCD_renderBeginInst(Lcd* a_lcd_Ptr);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_renderEndInst
+[Description] :	This function is responsible for ending a render pass started by LCD_renderBeginInst
+				
+[Args] :
+[in] Lcd* a_lcd_Ptr:
+a_lcd_Ptr: pointer to the display handle
+[Returns] : 1 if the application must draw again to send the changed spans, or 0 if the render is done
+--------------------------------------------------------------------------------------------------------------- */
+EXTERN uint8 LCD_renderEndInst(Lcd* a_lcd_Ptr);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_setDirectionInst
+[Description] : This function is responsible for setting the direction of the text: with LCD_DIRECTION_RTL the
+				characters of a string go from the cursor to the left, so a right-to-left text is written in its
+				logical order from the last column of its field without being reversed, and a number is written
+				with LCD_DIRECTION_LTR. The decrement or increment entry mode is sent before the next character only
+				if the controllers don't have it already, a display with a frame only moves its logical cursor.
+				LCD_DIRECTION_KEEP, the default, leaves the entry mode to the application
+				
+[Args] :
+[in] Lcd* a_lcd_Ptr, uint8 a_direction:
+a_lcd_Ptr: pointer to the display handle
+a_direction: LCD_DIRECTION_KEEP, LCD_DIRECTION_LTR or LCD_DIRECTION_RTL
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+EXTERN void LCD_setDirectionInst(Lcd* a_lcd_Ptr, uint8 a_direction);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_displayCharacterInst
 [Description] : This function is responsible for sending character to the lcd, it call the LCD_write function which
 				takes two parameters, 1st the data to be sent to LCD, and the data type whether it's a data character 
-				or a command byte, so we call LCD_write and send 1 to indicate that it's a data not command
+				or a command byte, so we call LCD_write and send LCD_XFER_DATA to indicate that it's a data not command.
+				In the right to left direction the text stops at column 0, written directly, in a frame or in a CRC
+				render the characters after the one of column 0 are dropped till the cursor is moved, instead of
+				going where the address counter of the controller leads
 				
 [Args] :
-[in] uint8 a_command:
-The command to be executed in the LCD
+[in] Lcd* a_lcd_Ptr, uint8 a_dataCharacter:
+a_lcd_Ptr: pointer to the display handle
+a_dataCharacter: The character to be displayed
 [Returns] : This function return void
 --------------------------------------------------------------------------------------------------------------- */
-EXTERN void LCD_displayCharacter(uint8 a_dataCharacter);
+EXTERN void LCD_displayCharacterInst(Lcd* a_lcd_Ptr, uint8 a_dataCharacter);
 
 /* ---------------------------------------------------------------------------------------------------------------
-[Function Name] : LCD_displayString
+[Function Name] : LCD_defineCharacterInst
+[Description] : This function is responsible for writing a custom character to the CGRAM of every controller of the
+				display, then the cursor of a display without frame goes back where it was so the next characters
+				are written to the DDRAM again. A character already shown changes on the display at once
+				
+[Args] :
+[in] Lcd* a_lcd_Ptr, uint8 a_code, const uint8* a_rows_Ptr:
+a_lcd_Ptr: pointer to the display handle
+a_code: the custom character [0-7], it is displayed with the code LCD_GLYPH_CODE + a_code
+a_rows_Ptr: LCD_GLYPH_ROWS rows of 5 dots from the top, bit 4 is the left dot
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+EXTERN void LCD_defineCharacterInst(Lcd* a_lcd_Ptr, uint8 a_code, const uint8* a_rows_Ptr);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_displayStringInst
 [Description] : This function is responsible for displaying string on the lcd, by displaying it character by character
 				till it reach the terminator character
 				
 [Args] :
-[in] const uint8 *a_dataString_Ptr:
+[in] Lcd* a_lcd_Ptr, const uint8 *a_dataString_Ptr:
+a_lcd_Ptr: pointer to the display handle
 a_dataString_Ptr is a pointer to character
 [Returns] : This function return void
 --------------------------------------------------------------------------------------------------------------- */
-EXTERN void LCD_displayString(const uint8* a_dataString_Ptr);
+EXTERN void LCD_displayStringInst(Lcd* a_lcd_Ptr, const uint8* a_dataString_Ptr);
 
 /* ---------------------------------------------------------------------------------------------------------------
-[Function Name] : LCD_clearScreen
+[Function Name] : LCD_clearScreenInst
 [Description] : This function is responsible for clearing the lcd by sending the clearing command CLEAR_COMMAND
 				
 [Args] :
-[in] void:
+[in] Lcd* a_lcd_Ptr:
+a_lcd_Ptr: pointer to the display handle
 [Returns] : This function return void
 --------------------------------------------------------------------------------------------------------------- */
-EXTERN void LCD_clearScreen(void);
+EXTERN void LCD_clearScreenInst(Lcd* a_lcd_Ptr);
 
 /* ---------------------------------------------------------------------------------------------------------------
-[Function Name] : LCD_displayStringRowColumn
+[Function Name] : LCD_displayStringRowColumnInst
 [Description] : This function is responsible for moving the cursor to a specific row and column on the lcd screen
 				and display a string from this position
 				
 [Args] :
-[in] uint8 a_row,uint8 a_col,const char *a_str_Ptr:
+[in] Lcd* a_lcd_Ptr, uint8 a_row,uint8 a_col,const char *a_str_Ptr:
+a_lcd_Ptr: pointer to the display handle
 uint8 a_row, the row number
 uint8 a_col, the column number
 const char *a_str_Ptr, pointer to the sting to be displayed character by charater using displayCharacter function 
 [Returns] : This function return void
 --------------------------------------------------------------------------------------------------------------- */
-EXTERN void LCD_displayStringRowColumn(uint8 a_row, uint8 a_col, const uint8 *a_str_Ptr);
+EXTERN void LCD_displayStringRowColumnInst(Lcd* a_lcd_Ptr, uint8 a_row, uint8 a_col, const uint8 *a_str_Ptr);
 
 /* ---------------------------------------------------------------------------------------------------------------
-[Function Name] : LCD_goToRowColumn
+[Function Name] : LCD_displayStringRowColumnRtlInst
+[Description] : This function is responsible for displaying a right-to-left string in its logical order, its first
+				character at a position and the next ones on its left, the display stays in LCD_DIRECTION_RTL
+				
+[Args] :
+[in] Lcd* a_lcd_Ptr, uint8 a_row, uint8 a_col, const uint8 *a_str_Ptr:
+a_lcd_Ptr: pointer to the display handle
+a_row, a_col: position of the first character, the last column of the field
+a_str_Ptr: pointer to the string
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+EXTERN void LCD_displayStringRowColumnRtlInst(Lcd* a_lcd_Ptr, uint8 a_row, uint8 a_col, const uint8 *a_str_Ptr);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_displayStringRowColumnLtrInst
+[Description] : This function is responsible for displaying a left-to-right string, a number in a right-to-left
+				screen for example, the display stays in LCD_DIRECTION_LTR
+				
+[Args] :
+[in] Lcd* a_lcd_Ptr, uint8 a_row, uint8 a_col, const uint8 *a_str_Ptr:
+a_lcd_Ptr: pointer to the display handle
+a_row, a_col: position of the first character
+a_str_Ptr: pointer to the string
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+EXTERN void LCD_displayStringRowColumnLtrInst(Lcd* a_lcd_Ptr, uint8 a_row, uint8 a_col, const uint8 *a_str_Ptr);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_goToRowColumnInst
 [Description] : This function is responsible for moving the cursor to a specific row and column on the lcd screen
 				
 [Args] :
-[in] uint8 a_row,uint8 a_col:
+[in] Lcd* a_lcd_Ptr, uint8 a_row,uint8 a_col:
+a_lcd_Ptr: pointer to the display handle
 uint8 a_row, the row number
 uint8 a_col, the column number
 [Returns] : This function return void
 --------------------------------------------------------------------------------------------------------------- */
-EXTERN void LCD_goToRowColumn(uint8 a_row, uint8 a_col);
+EXTERN void LCD_goToRowColumnInst(Lcd* a_lcd_Ptr, uint8 a_row, uint8 a_col);
 
 /* ---------------------------------------------------------------------------------------------------------------
-[Function Name] : LCD_displayNumber
+[Function Name] : LCD_displayNumberInst
 [Description] : This function is responsible for displaying integer numbers on the lcd by converting this integer 
 				to string using the itoa function and then display it as string, the value can be represented as
 				binary, decimal, octal, hexadecimal, or any other base from 2 to 35.
 				
 [Args] :
-[in] uint16 a_data, uint8 a_base:
+[in] Lcd* a_lcd_Ptr, sint32 a_data, uint8 a_base:
+a_lcd_Ptr: pointer to the display handle
 a_data: The number value to be displayed on the LCD
 a_base: The number base to be displayed on the LCD 
 	Base can be any integer number from 2 to 35
@@ -246,6 +1127,93 @@ a_base: The number base to be displayed on the LCD
 		16 represent hexadecimal, ..etc
 [Returns] : This function return void
 --------------------------------------------------------------------------------------------------------------- */
-EXTERN void LCD_displayNumber(sint32 a_data, uint8 a_base);
+EXTERN void LCD_displayNumberInst(Lcd* a_lcd_Ptr, sint32 a_data, uint8 a_base);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_formatNumber
+[Description] : This function is responsible for converting an integer number to the string displayed by
+				LCD_displayNumberInst, without writing it, so modules can pad or align it first
+				
+[Args] :
+[in] sint32 a_data, uint8 a_base:
+a_data: The number value to be converted
+a_base: The number base, any integer number from 2 to 35
+[out] uint8* a_str_Ptr:
+a_str_Ptr: buffer of LCD_NUMBER_LENGTH characters receiving the string, empty if the base is not valid
+[Returns] : The length of the string
+--------------------------------------------------------------------------------------------------------------- */
+EXTERN uint8 LCD_formatNumber(sint32 a_data, uint8* a_str_Ptr, uint8 a_base);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_displayFixedInst
+[Description] : This function is responsible for displaying a scaled integer as a decimal number with a fixed number
+				of fraction digits, 2345 with 2 fraction digits is "23.45" and -7 with 1 is "-0.7". The digits come
+				from subtracting the powers of ten, there is no float library, and the number is right aligned in
+				its field so the old digits are overwritten. More than LCD_FIXED_MAX_FRAC fraction digits are
+				rounded to LCD_FIXED_MAX_FRAC by the only division, 7 with 12 fraction digits is "0.000000000"
+				
+[Args] :
+[in] Lcd* a_lcd_Ptr, sint32 a_value, uint8 a_fracDigits, uint8 a_width:
+a_lcd_Ptr: pointer to the display handle
+a_value: the value multiplied by 10 to the power a_fracDigits
+a_fracDigits: digits after the decimal point, LCD_FIXED_MAX_FRAC are shown at most
+a_width: characters of the field padded with spaces on the left, 0 for no padding, a number wider than the
+		 field is shown as a_width LCD_NUMBER_OVERFLOW characters
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+EXTERN void LCD_displayFixedInst(Lcd* a_lcd_Ptr, sint32 a_value, uint8 a_fracDigits, uint8 a_width);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_displayFloatInst
+[Description] : This function is responsible for displaying a float with a fixed number of fraction digits, it is
+				rounded to a scaled integer and displayed by LCD_displayFixedInst, so only a float multiplication is
+				linked instead of the float printf or dtostrf. More than LCD_FIXED_MAX_FRAC fraction digits are
+				rounded to LCD_FIXED_MAX_FRAC
+				
+[Args] :
+[in] Lcd* a_lcd_Ptr, float a_value, uint8 a_fracDigits, uint8 a_width:
+a_lcd_Ptr: pointer to the display handle
+a_value: the value, its scaled value must be within a sint32 else the field shows LCD_NUMBER_OVERFLOW, a
+		 single one without a field
+a_fracDigits: digits after the decimal point, LCD_FIXED_MAX_FRAC are shown at most
+a_width: characters of the field padded with spaces on the left, 0 for no padding
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+EXTERN void LCD_displayFloatInst(Lcd* a_lcd_Ptr, float a_value, uint8 a_fracDigits, uint8 a_width);
+
+/*------------------------------------ SINGLETON FUNCTION-LIKE MACROS ------------------------------------------*/
+/*	These are the functions of the default display g_lcd, they are kept with the same names and arguments so old
+*	applications still work, each one is replaced by the instance function with the constant g_lcd address
+*/
+#define LCD_init(a_cursorState)							LCD_initInst(&g_lcd, (a_cursorState))
+#define LCD_warmInit(a_cursorState)						LCD_warmInitInst(&g_lcd, (a_cursorState))
+#define LCD_scrub(a_cells)								LCD_scrubInst(&g_lcd, (a_cells))
+#define LCD_sendCommand(a_command)						LCD_sendCommandInst(&g_lcd, (a_command))
+#define LCD_setDirection(a_direction)					LCD_setDirectionInst(&g_lcd, (a_direction))
+#define LCD_displayCharacter(a_dataCharacter)			LCD_displayCharacterInst(&g_lcd, (a_dataCharacter))
+#define LCD_defineCharacter(a_code, a_rows_Ptr)			LCD_defineCharacterInst(&g_lcd, (a_code), (a_rows_Ptr))
+#define LCD_displayString(a_dataString_Ptr)				LCD_displayStringInst(&g_lcd, (const uint8*)(a_dataString_Ptr))
+#define LCD_clearScreen()								LCD_clearScreenInst(&g_lcd)
+#define LCD_displayStringRowColumn(a_row, a_col, a_str_Ptr)	\
+		LCD_displayStringRowColumnInst(&g_lcd, (a_row), (a_col), (const uint8*)(a_str_Ptr))
+#define LCD_displayStringRowColumnRtl(a_row, a_col, a_str_Ptr)	\
+		LCD_displayStringRowColumnRtlInst(&g_lcd, (a_row), (a_col), (const uint8*)(a_str_Ptr))
+#define LCD_displayStringRowColumnLtr(a_row, a_col, a_str_Ptr)	\
+		LCD_displayStringRowColumnLtrInst(&g_lcd, (a_row), (a_col), (const uint8*)(a_str_Ptr))
+#define LCD_goToRowColumn(a_row, a_col)					LCD_goToRowColumnInst(&g_lcd, (a_row), (a_col))
+#define LCD_displayNumber(a_data, a_base)				LCD_displayNumberInst(&g_lcd, (a_data), (a_base))
+#define LCD_displayFixed(a_value, a_fracDigits, a_width)	LCD_displayFixedInst(&g_lcd, (a_value), (a_fracDigits), (a_width))
+#define LCD_displayFloat(a_value, a_fracDigits, a_width)	LCD_displayFloatInst(&g_lcd, (a_value), (a_fracDigits), (a_width))
+#define LCD_flush()										LCD_flushInst(&g_lcd)
+#define LCD_setLane(a_lane)								LCD_setLaneInst(&g_lcd, (a_lane))
+#define LCD_attachFrame(a_frame_Ptr)					LCD_attachFrameInst(&g_lcd, (a_frame_Ptr))
+#define LCD_beginFrame()								LCD_beginFrameInst(&g_lcd)
+#define LCD_commitFrame()								LCD_commitFrameInst(&g_lcd)
+#define LCD_setCost(a_dataUs, a_cmdUs)					LCD_setCostInst(&g_lcd, (a_dataUs), (a_cmdUs))
+#define LCD_getStats(a_stats_Ptr)						LCD_getStatsInst(&g_lcd, (a_stats_Ptr))
+#define LCD_clearStats()								LCD_clearStatsInst(&g_lcd)
+#define LCD_attachCrcFrame(a_crc_Ptr)					LCD_attachCrcFrameInst(&g_lcd, (a_crc_Ptr))
+#define LCD_renderBegin()								LCD_renderBeginInst(&g_lcd)
+#define LCD_renderEnd()									LCD_renderEndInst(&g_lcd)
 
 #endif /* LCD_H_ */
\ No newline at end of file
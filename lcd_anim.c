@@ -0,0 +1,148 @@
+/* --------------------------------------------------------------------------------------------------
+[FILE NAME]:		<lcd_anim.c>
+[AUTHOR(S)]:		<Ayman Younis>
+[DATE CREATED]:		<18/10/2026>
+[DESCRIPTION]:		This file contains the lcd animation player source file, keyframe and delta frame streams in
+*					the flash played at the pace of Timer0.
+[USAGE]:			<See the C include lcd_anim.h file for a description of each function>
+-------------------------------------------------------------------------------------------------- */
+
+/*--------------------------------------------- INCLUDES ------------------------------------------*/
+#define LCD_ANIM_H_MAIN
+#include "lcd_anim.h"
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_animFrame
+[Description] :	This function is responsible for applying the frame at s_next_Ptr and moving s_next_Ptr to the next
+				one, LCD_ANIM_LOOP and LCD_ANIM_STOP are handled here
+
+[Args] :
+[in] LcdAnim* a_anim_Ptr:
+a_anim_Ptr: pointer to the player
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+static void LCD_animFrame(LcdAnim* a_anim_Ptr);
+
+/*------------------------------------- FUNCTION Definitions --------------------------------------*/
+/*----------------------------------------- LCD_animStart ------------------------------------------*/
+void LCD_animStart(LcdAnim* a_anim_Ptr, Lcd* a_lcd_Ptr, const uint8* a_stream_Ptr, uint16 a_periodMs)
+{
+	a_anim_Ptr->s_lcd_Ptr	= a_lcd_Ptr;
+	a_anim_Ptr->s_next_Ptr	= a_stream_Ptr;
+	a_anim_Ptr->s_loop_Ptr	= a_stream_Ptr;
+	/* from the milli seconds, 65535 of them fit the product up to F_CPU 65MHz */
+	a_anim_Ptr->s_periodTicks	= ((uint32)a_periodMs * (F_CPU / 1000UL) + TIMER0_DIVIDER - 1) / TIMER0_DIVIDER;
+	a_anim_Ptr->s_waitTicks		= a_anim_Ptr->s_periodTicks;
+	a_anim_Ptr->s_hold		= 0;
+	a_anim_Ptr->s_state		= LCD_ANIM_PLAYING;
+
+	LCD_animFrame(a_anim_Ptr);
+	a_anim_Ptr->s_loop_Ptr	= a_anim_Ptr->s_next_Ptr;
+	a_anim_Ptr->s_ticks		= TIMER0_ticksLong();
+}
+
+/*---------------------------------------- LCD_animService -----------------------------------------*/
+uint8 LCD_animService(LcdAnim* a_anim_Ptr)
+{
+	uint32 ticks;
+	uint32 elapsed;
+
+	if (a_anim_Ptr->s_state == LCD_ANIM_STOPPED)
+	{
+		return LCD_ANIM_STOPPED;
+	}
+
+	/* counted in ticks, a time in micro seconds would overflow the conversion after a few seconds */
+	ticks = TIMER0_ticksLong();
+	elapsed = ticks - a_anim_Ptr->s_ticks;
+	a_anim_Ptr->s_ticks = ticks;
+	if (elapsed < a_anim_Ptr->s_waitTicks)
+	{
+		a_anim_Ptr->s_waitTicks -= elapsed;
+		return LCD_ANIM_PLAYING;
+	}
+
+	/* the lateness is taken from the next period, more than a period late the next frame is due at once */
+	elapsed -= a_anim_Ptr->s_waitTicks;
+	a_anim_Ptr->s_waitTicks = (elapsed < a_anim_Ptr->s_periodTicks) ? (a_anim_Ptr->s_periodTicks - elapsed) : 0;
+
+	if (a_anim_Ptr->s_hold != 0)
+	{
+		a_anim_Ptr->s_hold--;
+	}
+	else
+	{
+		LCD_animFrame(a_anim_Ptr);
+	}
+	return a_anim_Ptr->s_state;
+}
+
+/*----------------------------------------- LCD_animStop -------------------------------------------*/
+void LCD_animStop(LcdAnim* a_anim_Ptr)
+{
+	a_anim_Ptr->s_state = LCD_ANIM_STOPPED;
+}
+
+/*----------------------------------------- LCD_animFrame ------------------------------------------*/
+static void LCD_animFrame(LcdAnim* a_anim_Ptr)
+{
+	const uint8* next_Ptr = a_anim_Ptr->s_next_Ptr;
+	uint8 rows[LCD_GLYPH_ROWS];
+	uint8 code;
+	uint8 length;
+	uint8 position;
+	uint8 loop;
+
+	for (;;)
+	{
+		code = FLASH_READ_BYTE(next_Ptr++);
+		if (code == LCD_ANIM_FRAME_END)
+		{
+			break;
+		}
+		else if (code == LCD_ANIM_STOP)
+		{
+			/* the stream stays on LCD_ANIM_STOP */
+			next_Ptr--;
+			a_anim_Ptr->s_state = LCD_ANIM_STOPPED;
+			break;
+		}
+		else if (code == LCD_ANIM_LOOP)
+		{
+			/* without a frame after the keyframe there is nothing to play again */
+			if (next_Ptr - 1 == a_anim_Ptr->s_loop_Ptr)
+			{
+				next_Ptr--;
+				break;
+			}
+			next_Ptr = a_anim_Ptr->s_loop_Ptr;
+		}
+		else if (code == LCD_ANIM_CLEAR)
+		{
+			LCD_clearScreenInst(a_anim_Ptr->s_lcd_Ptr);
+		}
+		else if (code == LCD_ANIM_HOLD)
+		{
+			a_anim_Ptr->s_hold = FLASH_READ_BYTE(next_Ptr++);
+		}
+		else if ((code & LCD_ANIM_RUN_CODE) != 0)
+		{
+			length = code & LCD_ANIM_RUN_MAX;
+			position = FLASH_READ_BYTE(next_Ptr++);
+			LCD_goToRowColumnInst(a_anim_Ptr->s_lcd_Ptr, position >> LCD_ANIM_ROW_SHIFT, position & LCD_ANIM_COL_MASK);
+			for (loop=0;loop<length;loop++)
+			{
+				LCD_displayCharacterInst(a_anim_Ptr->s_lcd_Ptr, FLASH_READ_BYTE(next_Ptr++));
+			}
+		}
+		else if ((code & LCD_ANIM_GLYPH_CODE) != 0)
+		{
+			for (loop=0;loop<LCD_GLYPH_ROWS;loop++)
+			{
+				rows[loop] = FLASH_READ_BYTE(next_Ptr++);
+			}
+			LCD_defineCharacterInst(a_anim_Ptr->s_lcd_Ptr, code & (LCD_GLYPHS - 1), rows);
+		}
+	}
+	a_anim_Ptr->s_next_Ptr = next_Ptr;
+}
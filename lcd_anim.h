@@ -0,0 +1,145 @@
+/* --------------------------------------------------------------------------------------------------
+[FILE NAME]:		<lcd_anim.h>
+[AUTHOR(S)]:		<Ayman Younis>
+[DATE CREATED]:		<18/10/2026>
+[DESCRIPTION]:		This file contains the lcd animation player header file, boot animations and spinners stored in
+*					the flash as a keyframe followed by delta frames, played at the pace of Timer0 without blocking
+*					the main loop.
+*
+*					An animation is a FLASH_CONST byte stream written with the LCD_ANIM_ macros: each frame is a
+*					list of runs (a position and the characters written from it) and custom character updates,
+*					ended by LCD_ANIM_FRAME_END. The first frame is the keyframe, it draws the whole animation
+*					area (LCD_ANIM_CLEAR first if needed), the next ones hold only the cells which change, so a
+*					spinner frame is one character and a few bytes of flash. The stream ends with LCD_ANIM_STOP,
+*					the last frame stays shown, or LCD_ANIM_LOOP which goes on with the frame after the keyframe,
+*					the last frame must then lead back to the keyframe.
+*
+*					The main loop calls LCD_animService, it reads the 32-bit Timer0 ticks (TIMER0_init must be
+*					called and the interrupts enabled, see timer.h) and applies the next frame when its period has
+*					elapsed. The periods and the time between two calls can be longer than the wrap of the 16-bit
+*					ticks, up to the wrap of the 32-bit ones (9.5 hours with 8us ticks).
+*					The frame is applied between two calls of the main loop, never from an interrupt, so it can't
+*					tear the writes of the application. With a frame buffer attached to the display the frame only
+*					changes the buffer and LCD_service writes the changed cells in its budget, without it the
+*					cells of the frame are written at once.
+-------------------------------------------------------------------------------------------------- */
+
+/*	LCD_ANIM_H_MAIN will be defined at the lcd animation source file only, so the EXTERN will be removed, also
+*   EXTERN becomes extern in other files that include lcd_anim.h
+*/
+#ifdef LCD_ANIM_H_MAIN
+#define EXTERN
+#else
+#define EXTERN extern
+#endif
+
+#ifndef LCD_ANIM_H_
+#define LCD_ANIM_H_
+
+/*--------------------------------------------- INCLUDES -------------------------------------------*/
+#include "lcd.h"
+#include "flash_mem.h"
+#include "timer.h"
+
+/*---------------------------------- Definitions and configurations --------------------------------*/
+/*	codes of the animation stream */
+#define LCD_ANIM_FRAME_END		0x00					/**< end of the frame						*/
+#define LCD_ANIM_CLEAR			0x01					/**< clear the display						*/
+#define LCD_ANIM_HOLD			0x02					/**< + n: show the frame n periods more		*/
+#define LCD_ANIM_STOP			0x03					/**< end of the animation					*/
+#define LCD_ANIM_LOOP			0x04					/**< go on with the frame after the keyframe	*/
+#define LCD_ANIM_GLYPH_CODE		0x40					/**< | code: + LCD_GLYPH_ROWS rows			*/
+#define LCD_ANIM_RUN_CODE		0x80					/**< | length: + position + characters		*/
+
+/*	longest run, and the row and column bits of a run position */
+#define LCD_ANIM_RUN_MAX		0x3F
+#define LCD_ANIM_ROW_SHIFT		6
+#define LCD_ANIM_COL_MASK		0x3F
+
+/* ---------------------------------------------------------------------------------------------------
+[MACRO Name] : LCD_ANIM_RUN
+[Description] : This macro is responsible for starting a run of a frame, it is followed by its characters
+[Args] : a_row, a_col: position of the first character, a_length: number of characters, 1 to LCD_ANIM_RUN_MAX
+
+--------------------------------------------------------------------------------------------------- */
+#define LCD_ANIM_RUN(a_row, a_col, a_length)	\
+	(LCD_ANIM_RUN_CODE | (a_length)), (((a_row) << LCD_ANIM_ROW_SHIFT) | (a_col))
+
+/* ---------------------------------------------------------------------------------------------------
+[MACRO Name] : LCD_ANIM_GLYPH
+[Description] : This macro is responsible for starting a custom character update of a frame, it is followed by
+				its LCD_GLYPH_ROWS rows
+[Args] : a_code: the custom character, 0 to LCD_GLYPHS - 1
+
+--------------------------------------------------------------------------------------------------- */
+#define LCD_ANIM_GLYPH(a_code)					(LCD_ANIM_GLYPH_CODE | (a_code))
+
+/*	states of the player */
+#define LCD_ANIM_STOPPED		0
+#define LCD_ANIM_PLAYING		1
+
+/*-------------------------------------- Structures and Unions ---------------------------------------*/
+/* ---------------------------------------------------------------------------------------------------
+[Structure Name]: LcdAnim
+[Structure Description]: This structure is the player of one animation:
+									1. s_lcd_Ptr: the display
+									2. s_next_Ptr: next frame of the stream in the flash
+									3. s_loop_Ptr: frame after the keyframe, where LCD_ANIM_LOOP goes on
+									4. s_periodTicks: Timer0 ticks each frame is shown
+									5. s_waitTicks: Timer0 ticks left before the next frame
+									6. s_ticks: 32-bit Timer0 ticks of the last call of LCD_animService
+									7. s_hold: periods the shown frame is held more (LCD_ANIM_HOLD)
+									8. s_state: LCD_ANIM_STOPPED or LCD_ANIM_PLAYING
+---------------------------------------------------------------------------------------------------- */
+typedef struct
+{
+	Lcd* s_lcd_Ptr;
+	const uint8* s_next_Ptr;
+	const uint8* s_loop_Ptr;
+	uint32 s_periodTicks;
+	uint32 s_waitTicks;
+	uint32 s_ticks;
+	uint8 s_hold;
+	uint8 s_state;
+}LcdAnim;
+
+/*----------------------------------- FUNCTION DECLARATIONS ----------------------------------------------------*/
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_animStart
+[Description] :	This function is responsible for starting an animation, its keyframe is applied at once
+
+[Args] :
+[in] LcdAnim* a_anim_Ptr, Lcd* a_lcd_Ptr, const uint8* a_stream_Ptr, uint16 a_periodMs:
+a_anim_Ptr: pointer to the player
+a_lcd_Ptr: pointer to the display handle
+a_stream_Ptr: the animation stream (FLASH_CONST)
+a_periodMs: time each frame is shown in milli seconds
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+EXTERN void LCD_animStart(LcdAnim* a_anim_Ptr, Lcd* a_lcd_Ptr, const uint8* a_stream_Ptr, uint16 a_periodMs);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_animService
+[Description] :	This function is responsible for applying the next frame of an animation if its period has elapsed,
+				it is called from the main loop more often than the 32-bit Timer0 ticks wrap. A late call keeps the
+				pace, the next frame is then due sooner
+
+[Args] :
+[in] LcdAnim* a_anim_Ptr:
+a_anim_Ptr: pointer to the player
+[Returns] : LCD_ANIM_PLAYING, or LCD_ANIM_STOPPED once the animation reached LCD_ANIM_STOP or was stopped
+--------------------------------------------------------------------------------------------------------------- */
+EXTERN uint8 LCD_animService(LcdAnim* a_anim_Ptr);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_animStop
+[Description] :	This function is responsible for stopping an animation, the shown frame stays on the display
+
+[Args] :
+[in] LcdAnim* a_anim_Ptr:
+a_anim_Ptr: pointer to the player
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+EXTERN void LCD_animStop(LcdAnim* a_anim_Ptr);
+
+#endif /* LCD_ANIM_H_ */
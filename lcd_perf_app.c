@@ -0,0 +1,693 @@
+/* --------------------------------------------------------------------------------------------------
+[FILE NAME]:		<lcd_perf_app.c>
+[AUTHOR(S)]:		<Ayman Younis>
+[DATE CREATED]:		<18/10/2026>
+[DESCRIPTION]:		This file contains the source main functions of the performance regression runner, it is built
+*					for the PC with the host emulation and replays representative workloads on the default display:
+*
+*					gcc -DHOST_EMULATION -o lcd_perf lcd_perf_app.c lcd.c dio.c host_emu.c lcd_trace.c lcd_utf8.c lcd_anim.c timer.c
+*					./lcd_perf [baseline file] [-update]
+*
+*					For each workload it measures the simulated time the CPU is blocked, the enable strobes, the
+*					bytes sent to the controller and the CPU cycles of the DIO accesses, and compares them with
+*					the baseline file (lcd_perf_baseline.txt by default). It fails (exit code 1) if a workload is
+*					more than LCD_PERF_TOLERANCE_PCT worse, or if the tracer of lcd_trace.h finds a timing
+*					violation, so a faster driver must still respect the datasheet. The enable strobes also drive
+*					the HD44780 emulated by host_emu.h, each workload fails if the text it leaves in the DDRAM
+*					isn't the expected screen, so a faster driver must still show the same characters. Short
+*					cases of edge inputs are checked the same way after the workloads, they are not measured. -update
+*					writes the results as the new baseline, commit it with the change which made the driver
+*					faster.
+-------------------------------------------------------------------------------------------------- */
+
+/*--------------------------------------------- INCLUDES ------------------------------------------*/
+#include "lcd.h"
+#include "lcd_trace.h"
+#include "lcd_utf8.h"
+#include "lcd_anim.h"
+#include <stdio.h>
+#include <string.h>
+
+#ifndef HOST_EMULATION
+#error "lcd_perf_app.c is built with the host emulation only, define HOST_EMULATION"
+#endif
+
+/*---------------------------------- Definitions and configurations --------------------------------*/
+/*	a metric can be this percentage worse than the baseline before the run fails */
+#define LCD_PERF_TOLERANCE_PCT	2
+
+#define LCD_PERF_BASELINE		"lcd_perf_baseline.txt"
+#define LCD_PERF_TRACE			"lcd_perf.vcd"
+#define LCD_PERF_METRICS		4
+#define LCD_PERF_NAME_LENGTH	24
+
+/*-------------------------------------- Structures and Unions ---------------------------------------*/
+/* ---------------------------------------------------------------------------------------------------
+[Structure Name]: LcdPerfWorkload
+[Structure Description]: This structure is one workload and its results:
+								1. s_name: name of the workload in the baseline file
+								2. s_run_Ptr: the function which replays it
+								3. s_screen: the text each row must show at the end, shorter rows end with spaces
+								4. s_metric: time in micro seconds, enable strobes, bytes and DIO cycles
+---------------------------------------------------------------------------------------------------- */
+typedef struct
+{
+	const char* s_name;
+	void (*s_run_Ptr)(void);
+	const char* s_screen[LCD_MAX_LINES];
+	uint32 s_metric[LCD_PERF_METRICS];
+}LcdPerfWorkload;
+
+/*-------------------------------------- Static FUNCTION DECLARATIONS --------------------------------------------*/
+static void PERF_init(void);
+static void PERF_testApp(void);
+static void PERF_testAppFrame(void);
+static void PERF_dashboard(void);
+static void PERF_menu(void);
+static void PERF_repaint(void);
+static void PERF_fixedFraction(void);
+static void PERF_floatFraction(void);
+static void PERF_rtlText(void);
+static void PERF_rtlDirect(void);
+static void PERF_rtlFrame(void);
+static void PERF_rtlCrc(void);
+static void PERF_utf8Missing(void);
+static void PERF_animLongPeriod(void);
+static const uint8* PERF_glyph(uint16 a_codePoint);
+static void PERF_countStrobes(void);
+static void PERF_attach(void);
+static void PERF_measure(LcdPerfWorkload* a_workload_Ptr);
+static uint8 PERF_check(const LcdPerfWorkload* a_workload_Ptr);
+static uint8 PERF_compare(const char* a_path_Ptr, LcdPerfWorkload* a_workloads_Ptr, uint8 a_count);
+static uint8 PERF_write(const char* a_path_Ptr, const LcdPerfWorkload* a_workloads_Ptr, uint8 a_count);
+
+/*------------------------------------------ Global Variables ------------------------------------------*/
+static const char* const g_s_metricNames[LCD_PERF_METRICS] = {"time_us", "strobes", "bytes", "cycles"};
+
+/* ---------------------------------------------------------------------------------------------------
+[Variable Name]: g_s_strobes, g_s_enLevel
+[Variable Description]: The enable falling edges counted by the host emulation observer, and the last level of
+						each enable pin
+---------------------------------------------------------------------------------------------------- */
+static uint32 g_s_strobes;
+static uint8 g_s_enLevel[LCD_MAX_CONTROLLERS];
+
+/* ---------------------------------------------------------------------------------------------------
+[Variable Name]: g_s_frame
+[Variable Description]: The frame buffer of the dashboard and the composed test application workloads
+---------------------------------------------------------------------------------------------------- */
+static LcdFrame g_s_frame;
+
+/* ---------------------------------------------------------------------------------------------------
+[Variable Name]: g_s_crc
+[Variable Description]: The span CRCs of the right to left CRC render case
+---------------------------------------------------------------------------------------------------- */
+static LcdCrcFrame g_s_crc;
+
+/* ---------------------------------------------------------------------------------------------------
+[Variable Name]: g_s_tildeRows
+[Variable Description]: The custom character of the tilde, it is not in the A00 ROM
+---------------------------------------------------------------------------------------------------- */
+static const uint8 g_s_tildeRows[LCD_GLYPH_ROWS] FLASH_CONST = {0x00, 0x00, 0x08, 0x15, 0x02, 0x00, 0x00, 0x00};
+
+/* ---------------------------------------------------------------------------------------------------
+[Variable Name]: g_s_animStream
+[Variable Description]: The animation of the long period case, a keyframe and one frame
+---------------------------------------------------------------------------------------------------- */
+static const uint8 g_s_animStream[] FLASH_CONST =
+{
+	LCD_ANIM_RUN(0, 0, 1), 'A', LCD_ANIM_FRAME_END,
+	LCD_ANIM_RUN(0, 0, 1), 'B', LCD_ANIM_FRAME_END,
+	LCD_ANIM_STOP
+};
+
+/*------------------------------------------ main function ----------------------------------------*/
+int main(int argc, char* argv[])
+{
+	LcdPerfWorkload workloads[] =
+	{
+		{"init",		PERF_init,		{"", "", "", ""},	{0}},
+		{"test_app",	PERF_testApp,	{"", "", "", ""},	{0}},
+		{"test_app_frame",	PERF_testAppFrame,
+			{" EmbeddedC_Project2", "Ayman_ITI  18/1/2015", "", ""},	{0}},
+		{"dashboard",	PERF_dashboard,
+			{"RPM  1543  TMP  84", "BAT 12.9V OIL  45", "TRIP   1009 km", "STATUS OK"},	{0}},
+		{"menu",		PERF_menu,
+			{"  Settings", "  Display", "  Network", "> Sensors"},	{0}},
+		{"repaint",		PERF_repaint,
+			{"line 0 frame  9 ....", "line 1 frame  9 ....", "line 2 frame  9 ....", "line 3 frame  9 ...."},	{0}},
+	};
+	LcdPerfWorkload cases[] =
+	{
+		{"fixed_fraction",	PERF_fixedFraction,
+			{"0.000000000", "-0.000000001", "0.000000000", "0.000000012"},	{0}},
+		{"float_fraction",	PERF_floatFraction,
+			{"0.000000400", "0.000000002", "0.000000000", ""},	{0}},
+		{"rtl_direct",	PERF_rtlDirect,	{"", "!zyx", "cba", ""},	{0}},
+		{"rtl_frame",	PERF_rtlFrame,	{"", "!zyx", "cba", ""},	{0}},
+		{"rtl_crc",		PERF_rtlCrc,	{"", "!zyx", "cba", ""},	{0}},
+		{"utf8_missing",	PERF_utf8Missing,	{"??\x08" "a?", "", "", ""},	{0}},
+		{"anim_long_period",	PERF_animLongPeriod,	{"B", "", "", ""},	{0}},
+	};
+	uint8 count = sizeof(workloads) / sizeof(workloads[0]);
+	const char* path_Ptr = LCD_PERF_BASELINE;
+	uint8 update = 0;
+	uint8 failed;
+	uint8 loop;
+
+	for (loop=1;loop<argc;loop++)
+	{
+		if (strcmp(argv[loop], "-update") == 0)
+		{
+			update = 1;
+		}
+		else
+		{
+			path_Ptr = argv[loop];
+		}
+	}
+
+	if (LCD_traceOpen(LCD_PERF_TRACE) == 0)
+	{
+		printf("can't create %s\n", LCD_PERF_TRACE);
+		return 1;
+	}
+	HOST_addObserver(PERF_countStrobes);
+	PERF_attach();
+
+	printf("%-*s %10s %10s %10s %10s\n", LCD_PERF_NAME_LENGTH, "workload",
+		   g_s_metricNames[0], g_s_metricNames[1], g_s_metricNames[2], g_s_metricNames[3]);
+	failed = 0;
+	for (loop=0;loop<count;loop++)
+	{
+		PERF_measure(&workloads[loop]);
+		printf("%-*s %10lu %10lu %10lu %10lu\n", LCD_PERF_NAME_LENGTH, workloads[loop].s_name,
+			   workloads[loop].s_metric[0], workloads[loop].s_metric[1],
+			   workloads[loop].s_metric[2], workloads[loop].s_metric[3]);
+		if (PERF_check(&workloads[loop]) == 0)
+		{
+			failed = 1;
+		}
+	}
+	for (loop=0;loop<(sizeof(cases) / sizeof(cases[0]));loop++)
+	{
+		LCD_clearScreen();
+		cases[loop].s_run_Ptr();
+		LCD_flush();
+		if (PERF_check(&cases[loop]) == 0)
+		{
+			failed = 1;
+		}
+	}
+	LCD_traceClose();
+
+	if (LCD_traceViolations() != 0)
+	{
+		printf("FAIL: %u timing violations, see %s\n", LCD_traceViolations(), LCD_PERF_TRACE);
+		failed = 1;
+	}
+	if (update)
+	{
+		return (PERF_write(path_Ptr, workloads, count) && !failed) ? 0 : 1;
+	}
+	if (PERF_compare(path_Ptr, workloads, count) == 0)
+	{
+		failed = 1;
+	}
+	printf(failed ? "FAIL\n" : "PASS\n");
+	return failed;
+}
+
+/*------------------------------------- FUNCTION Definitions --------------------------------------*/
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : PERF_init
+[Description] :	This function is the cold start workload, including the power-on wait
+--------------------------------------------------------------------------------------------------------------- */
+static void PERF_init(void)
+{
+	LCD_init(LCD_CURSOR_OFF);
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : PERF_testApp
+[Description] :	This function is one loop of lcd_test_app.c without its delays: text, scrolling lines and clears
+--------------------------------------------------------------------------------------------------------------- */
+static void PERF_testApp(void)
+{
+	sint8 i;
+
+	LCD_displayStringRowColumn(0,4,"Hello World!");
+	LCD_goToRowColumn(1,1);
+	LCD_displayString("TESTING LCD DRIVER");
+	LCD_clearScreen();
+	for (i=20;i>=0;i--)
+	{
+		LCD_clearScreen();
+		LCD_displayStringRowColumn(0,i+1,"EmbeddedC_Project2");
+		LCD_displayStringRowColumn(1,i,"Ayman_ITI  18/1/2015");
+	}
+	LCD_clearScreen();
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : PERF_testAppFrame
+[Description] :	This function is one loop of lcd_test_app.c composing each screen in a frame buffer between
+				LCD_beginFrame and LCD_commitFrame, the clears only blank the back buffer
+--------------------------------------------------------------------------------------------------------------- */
+static void PERF_testAppFrame(void)
+{
+	sint8 i;
+
+	LCD_clearScreen();
+	LCD_attachFrame(&g_s_frame);
+	LCD_beginFrame();
+	LCD_clearScreen();
+	LCD_displayStringRowColumn(0,4,"Hello World!");
+	LCD_goToRowColumn(1,1);
+	LCD_displayString("TESTING LCD DRIVER");
+	LCD_commitFrame();
+	for (i=20;i>=0;i--)
+	{
+		LCD_beginFrame();
+		LCD_clearScreen();
+		LCD_displayStringRowColumn(0,i+1,"EmbeddedC_Project2");
+		LCD_displayStringRowColumn(1,i,"Ayman_ITI  18/1/2015");
+		LCD_commitFrame();
+	}
+	LCD_attachFrame(0);
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : PERF_dashboard
+[Description] :	This function is the dashboard workload: fixed labels and four numeric fields redrawn 50 times in
+				a frame buffer, only a few digits change at each refresh
+--------------------------------------------------------------------------------------------------------------- */
+static void PERF_dashboard(void)
+{
+	uint8 buff[LCD_MAX_LENGTH + 1];
+	uint8 loop;
+
+	LCD_clearScreen();
+	LCD_attachFrame(&g_s_frame);
+	for (loop=0;loop<50;loop++)
+	{
+		sprintf((char*)buff, "RPM %5u  TMP %3u", (unsigned)(1200 + loop * 7), (unsigned)(80 + loop / 10));
+		LCD_displayStringRowColumn(0,0,buff);
+		sprintf((char*)buff, "BAT %2u.%01uV OIL %3u", 12u, (unsigned)(loop % 10), 45u);
+		LCD_displayStringRowColumn(1,0,buff);
+		sprintf((char*)buff, "TRIP %6lu km", 1000UL + loop / 5);
+		LCD_displayStringRowColumn(2,0,buff);
+		sprintf((char*)buff, "%s", (loop & 8) ? "WARN: CHECK OIL" : "STATUS OK      ");
+		LCD_displayStringRowColumn(3,0,buff);
+		LCD_flush();
+	}
+	LCD_attachFrame(0);
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : PERF_menu
+[Description] :	This function is the menu workload: a window of four items of a list of eight, with a marker on
+				the selected item, redrawn after each of 12 moves as a simple menu does
+--------------------------------------------------------------------------------------------------------------- */
+static void PERF_menu(void)
+{
+	static const char* const items[8] =
+	{
+		"Settings", "Display", "Network", "Sensors", "Alarms", "Logging", "Firmware", "About"
+	};
+	uint8 selected;
+	uint8 top = 0;
+	uint8 row;
+
+	LCD_clearScreen();
+	for (selected=0;selected<12;selected++)
+	{
+		if ((selected % 8) >= (top + 4))
+		{
+			top = (selected % 8) - 3;
+		}
+		else if ((selected % 8) < top)
+		{
+			top = selected % 8;
+		}
+		for (row=0;row<4;row++)
+		{
+			LCD_goToRowColumn(row,0);
+			LCD_displayCharacter(((top + row) == (selected % 8)) ? '>' : ' ');
+			LCD_displayStringRowColumn(row,1,"                   ");
+			LCD_displayStringRowColumn(row,2,(const uint8*)items[top + row]);
+		}
+	}
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : PERF_repaint
+[Description] :	This function is the full repaint workload: the four lines written 10 times in a batch
+--------------------------------------------------------------------------------------------------------------- */
+static void PERF_repaint(void)
+{
+	uint8 buff[LCD_MAX_LENGTH + 1];
+	uint8 loop;
+	uint8 row;
+
+	for (loop=0;loop<10;loop++)
+	{
+		LCD_beginBatch();
+		for (row=0;row<4;row++)
+		{
+			sprintf((char*)buff, "line %u frame %2u .....", (unsigned)row, (unsigned)loop);
+			buff[LCD_DISP_LENGTH] = '\0';
+			LCD_displayStringRowColumn(row,0,buff);
+		}
+		LCD_endBatch();
+	}
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : PERF_fixedFraction
+[Description] :	This function is the case of fixed-point numbers with more than LCD_FIXED_MAX_FRAC fraction digits,
+				the extra digits are rounded off and the magnitude stays right
+--------------------------------------------------------------------------------------------------------------- */
+static void PERF_fixedFraction(void)
+{
+	LCD_goToRowColumn(0,0);
+	LCD_displayFixed(7, 12, 0);
+	LCD_goToRowColumn(1,0);
+	LCD_displayFixed(-1499, 12, 0);
+	LCD_goToRowColumn(2,0);
+	LCD_displayFixed(-400, 12, 0);
+	LCD_goToRowColumn(3,0);
+	LCD_displayFixed(123456789, 16, 0);
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : PERF_floatFraction
+[Description] :	This function is the case of floats with more than LCD_FIXED_MAX_FRAC fraction digits and of fixed-
+				point numbers whose extra digits round them to the last digit or to 0
+--------------------------------------------------------------------------------------------------------------- */
+static void PERF_floatFraction(void)
+{
+	LCD_goToRowColumn(0,0);
+	LCD_displayFloat(0.0000004f, 10, 0);
+	LCD_goToRowColumn(1,0);
+	LCD_displayFixed(2000000000, 18, 0);
+	LCD_goToRowColumn(2,0);
+	LCD_displayFixed(2000000000, 19, 0);
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : PERF_rtlText
+[Description] :	This function writes right to left texts longer than their row from columns 2 and 3, the characters
+				after column 0 are dropped. Row 2 starts at 0x14 on the 20x4 display, the address counter of the
+				controller goes from there to the last column of row 0
+--------------------------------------------------------------------------------------------------------------- */
+static void PERF_rtlText(void)
+{
+	LCD_setDirection(LCD_DIRECTION_RTL);
+	LCD_goToRowColumn(2,2);
+	LCD_displayString("abcdef");
+	LCD_goToRowColumn(1,3);
+	LCD_displayString("xyz!?");
+	LCD_setDirection(LCD_DIRECTION_KEEP);
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : PERF_rtlDirect
+[Description] :	This function is the case of right to left texts passing column 0 written directly
+--------------------------------------------------------------------------------------------------------------- */
+static void PERF_rtlDirect(void)
+{
+	PERF_rtlText();
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : PERF_rtlFrame
+[Description] :	This function is the case of right to left texts passing column 0 written in a frame buffer
+--------------------------------------------------------------------------------------------------------------- */
+static void PERF_rtlFrame(void)
+{
+	LCD_attachFrame(&g_s_frame);
+	PERF_rtlText();
+	LCD_flush();
+	LCD_attachFrame(0);
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : PERF_rtlCrc
+[Description] :	This function is the case of right to left texts passing column 0 written in a CRC render
+--------------------------------------------------------------------------------------------------------------- */
+static void PERF_rtlCrc(void)
+{
+	LCD_attachCrcFrame(&g_s_crc);
+	do
+	{
+		LCD_renderBegin();
+		PERF_rtlText();
+	} while (LCD_renderEnd());
+	LCD_attachCrcFrame(0);
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : PERF_utf8Missing
+[Description] :	This function is the case of code points without a glyph on the A00 ROM: U+0000 and the backslash,
+				which has no custom character, are shown as LCD_UTF8_MISSING while the free custom characters
+				are taken by the tilde only
+--------------------------------------------------------------------------------------------------------------- */
+static void PERF_utf8Missing(void)
+{
+	LcdUtf8 utf8;
+
+	LCD_utf8Init(&utf8, &g_lcd, PERF_glyph);
+	LCD_goToRowColumn(0,0);
+	LCD_utf8DisplayCharacter(&utf8, 0x0000);
+	LCD_utf8DisplayString(&utf8, (const uint8*)"\\~a");
+	LCD_utf8DisplayCharacter(&utf8, 0x0000);
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : PERF_animLongPeriod
+[Description] :	This function is the case of a frame period longer than the wrap of the 16-bit Timer0 ticks: a
+				second frame of one second is due after two calls 700ms and 400ms apart
+--------------------------------------------------------------------------------------------------------------- */
+static void PERF_animLongPeriod(void)
+{
+	LcdAnim anim;
+
+	LCD_animStart(&anim, &g_lcd, g_s_animStream, 1000);
+	_delay_ms(700);
+	LCD_animService(&anim);
+	_delay_ms(400);
+	LCD_animService(&anim);
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : PERF_glyph
+[Description] :	This function returns the rows of the custom characters of the UTF-8 case, only the tilde has one
+--------------------------------------------------------------------------------------------------------------- */
+static const uint8* PERF_glyph(uint16 a_codePoint)
+{
+	return (a_codePoint == '~') ? g_s_tildeRows : 0;
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : PERF_countStrobes
+[Description] :	This function is the host emulation observer which counts the enable falling edges
+--------------------------------------------------------------------------------------------------------------- */
+static void PERF_countStrobes(void)
+{
+	uint8 ctrl;
+	uint8 level;
+
+	for (ctrl=0;ctrl<g_lcd.s_controllers;ctrl++)
+	{
+		level = HOST_readPin(g_lcd.s_ctrl[ctrl].s_en.s_port, g_lcd.s_ctrl[ctrl].s_en.s_pinNum);
+		if ((g_s_enLevel[ctrl] == LOGIC_HIGH) && (level == LOGIC_LOW))
+		{
+			g_s_strobes++;
+		}
+		g_s_enLevel[ctrl] = level;
+	}
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : PERF_attach
+[Description] :	This function is responsible for wiring an emulated controller to the pins of each controller of
+				the default display, before its first strobe
+--------------------------------------------------------------------------------------------------------------- */
+static void PERF_attach(void)
+{
+	HostLcdPins pins;
+	uint8 ctrl;
+	uint8 loop;
+
+	pins.s_rs.s_port = g_lcd.s_rs.s_port;
+	pins.s_rs.s_pinNum = g_lcd.s_rs.s_pinNum;
+	pins.s_rw.s_port = g_lcd.s_rw.s_port;
+	pins.s_rw.s_pinNum = g_lcd.s_rw.s_pinNum;
+	for (loop=0;loop<LCD_IO_MODE;loop++)
+	{
+		pins.s_data[loop].s_port = g_lcd.s_data[loop].s_port;
+		pins.s_data[loop].s_pinNum = g_lcd.s_data[loop].s_pinNum;
+	}
+	pins.s_width = LCD_IO_MODE;
+	for (ctrl=0;ctrl<g_lcd.s_controllers;ctrl++)
+	{
+		pins.s_en.s_port = g_lcd.s_ctrl[ctrl].s_en.s_port;
+		pins.s_en.s_pinNum = g_lcd.s_ctrl[ctrl].s_en.s_pinNum;
+		HOST_lcdAttach(ctrl, &pins);
+	}
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : PERF_measure
+[Description] :	This function is responsible for replaying one workload and measuring it, the queued writes are
+				flushed so all of its bus time is counted
+--------------------------------------------------------------------------------------------------------------- */
+static void PERF_measure(LcdPerfWorkload* a_workload_Ptr)
+{
+	HostTime start = HOST_timeNs();
+	uint32 strobes = g_s_strobes;
+	uint32 accesses = HOST_accessCount();
+	LcdStats stats;
+
+	LCD_clearStats();
+	a_workload_Ptr->s_run_Ptr();
+	LCD_flush();
+	LCD_getStats(&stats);
+	a_workload_Ptr->s_metric[0] = (uint32)((HOST_timeNs() - start) / 1000);
+	a_workload_Ptr->s_metric[1] = g_s_strobes - strobes;
+	a_workload_Ptr->s_metric[2] = (uint32)stats.s_dataWrites + stats.s_cmdWrites;
+	a_workload_Ptr->s_metric[3] = (HOST_accessCount() - accesses) * HOST_GPIO_CYCLES;
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : PERF_check
+[Description] :	This function is responsible for comparing each row of the emulated DDRAM with the expected screen
+				of a workload, the row is read from its DDRAM address on the controller which drives it
+[Returns] : 1 if the display shows the expected screen, 0 otherwise
+--------------------------------------------------------------------------------------------------------------- */
+static uint8 PERF_check(const LcdPerfWorkload* a_workload_Ptr)
+{
+	char shown[LCD_MAX_LENGTH + 1];
+	const char* expected_Ptr;
+	uint8 passed = 1;
+	uint8 row;
+	uint8 col;
+
+	for (row=0;row<g_lcd.s_lines;row++)
+	{
+		expected_Ptr = a_workload_Ptr->s_screen[row];
+		for (col=0;col<g_lcd.s_length;col++)
+		{
+			shown[col] = (char)HOST_lcdDdram(g_lcd.s_lineCtrl[row], g_lcd.s_lineStart[row] + col);
+		}
+		shown[col] = '\0';
+		for (col=0;col<g_lcd.s_length;col++)
+		{
+			if (shown[col] != ((*expected_Ptr != '\0') ? *expected_Ptr++ : ' '))
+			{
+				printf("WRONG SCREEN: %s row %u shows \"%s\" instead of \"%s\"\n", a_workload_Ptr->s_name,
+					   row, shown, a_workload_Ptr->s_screen[row]);
+				passed = 0;
+				break;
+			}
+		}
+	}
+	return passed;
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : PERF_compare
+[Description] :	This function is responsible for comparing the results with the baseline file, each line of it is
+				a workload name and its metrics, lines starting with # are comments
+[Returns] : 1 if no workload is slower than its baseline, 0 otherwise or if the file can't be read
+--------------------------------------------------------------------------------------------------------------- */
+static uint8 PERF_compare(const char* a_path_Ptr, LcdPerfWorkload* a_workloads_Ptr, uint8 a_count)
+{
+	FILE* file_Ptr = fopen(a_path_Ptr, "r");
+	char line[128];
+	char name[LCD_PERF_NAME_LENGTH + 1];
+	unsigned long base[LCD_PERF_METRICS];
+	uint8 found[32] = {0};
+	uint8 passed = 1;
+	uint8 loop;
+	uint8 metric;
+
+	if (file_Ptr == 0)
+	{
+		printf("no baseline %s, run with -update to create it\n", a_path_Ptr);
+		return 0;
+	}
+	while (fgets(line, sizeof(line), file_Ptr) != 0)
+	{
+		if ((line[0] == '#') ||
+			(sscanf(line, "%24s %lu %lu %lu %lu", name, &base[0], &base[1], &base[2], &base[3]) != 5))
+		{
+			continue;
+		}
+		for (loop=0;loop<a_count;loop++)
+		{
+			if (strcmp(name, a_workloads_Ptr[loop].s_name) != 0)
+			{
+				continue;
+			}
+			found[loop] = 1;
+			for (metric=0;metric<LCD_PERF_METRICS;metric++)
+			{
+				if ((a_workloads_Ptr[loop].s_metric[metric] * 100UL) >
+					(base[metric] * (100UL + LCD_PERF_TOLERANCE_PCT)))
+				{
+					printf("REGRESSION: %s %s %lu > baseline %lu\n", name, g_s_metricNames[metric],
+						   a_workloads_Ptr[loop].s_metric[metric], base[metric]);
+					passed = 0;
+				}
+				else if ((a_workloads_Ptr[loop].s_metric[metric] * 100UL) <
+						 (base[metric] * (100UL - LCD_PERF_TOLERANCE_PCT)))
+				{
+					printf("improved: %s %s %lu < baseline %lu, update the baseline\n", name,
+						   g_s_metricNames[metric], a_workloads_Ptr[loop].s_metric[metric], base[metric]);
+				}
+			}
+		}
+	}
+	fclose(file_Ptr);
+	for (loop=0;loop<a_count;loop++)
+	{
+		if (found[loop] == 0)
+		{
+			printf("no baseline for %s\n", a_workloads_Ptr[loop].s_name);
+			passed = 0;
+		}
+	}
+	return passed;
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : PERF_write
+[Description] :	This function is responsible for writing the results as the new baseline file
+[Returns] : 1 if the file is written, 0 otherwise
+--------------------------------------------------------------------------------------------------------------- */
+static uint8 PERF_write(const char* a_path_Ptr, const LcdPerfWorkload* a_workloads_Ptr, uint8 a_count)
+{
+	FILE* file_Ptr = fopen(a_path_Ptr, "w");
+	uint8 loop;
+
+	if (file_Ptr == 0)
+	{
+		printf("can't write %s\n", a_path_Ptr);
+		return 0;
+	}
+	fprintf(file_Ptr, "# lcd_perf_app baseline, F_CPU %lu, LCD_IO_MODE %u, HOST_GPIO_CYCLES %u\n",
+			(unsigned long)F_CPU, LCD_IO_MODE, HOST_GPIO_CYCLES);
+	fprintf(file_Ptr, "# workload %s %s %s %s\n",
+			g_s_metricNames[0], g_s_metricNames[1], g_s_metricNames[2], g_s_metricNames[3]);
+	for (loop=0;loop<a_count;loop++)
+	{
+		fprintf(file_Ptr, "%s %lu %lu %lu %lu\n", a_workloads_Ptr[loop].s_name,
+				a_workloads_Ptr[loop].s_metric[0], a_workloads_Ptr[loop].s_metric[1],
+				a_workloads_Ptr[loop].s_metric[2], a_workloads_Ptr[loop].s_metric[3]);
+	}
+	fclose(file_Ptr);
+	printf("baseline written to %s\n", a_path_Ptr);
+	return 1;
+}
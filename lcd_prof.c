@@ -0,0 +1,141 @@
+/* --------------------------------------------------------------------------------------------------
+[FILE NAME]:		<lcd_prof.c>
+[AUTHOR(S)]:		<Ayman Younis>
+[DATE CREATED]:		<18/10/2026>
+[DESCRIPTION]:		This file contains the lcd latency profiler source file, the statistics table filled by the
+*					profiled LCD functions when lcd.c is built with LCD_PROFILE defined.
+[USAGE]:			<See the C include lcd_prof.h file for a description of each function>
+-------------------------------------------------------------------------------------------------- */
+
+/*--------------------------------------------- INCLUDES ------------------------------------------*/
+#define LCD_PROF_H_MAIN
+#include "lcd_prof.h"
+
+/*------------------------------------------ Global Variables ------------------------------------------*/
+/* ---------------------------------------------------------------------------------------------------
+[Variable Name]: g_s_lcdProf
+[Variable Description]: The latency statistics of each profiled function
+---------------------------------------------------------------------------------------------------- */
+static LcdProfEntry g_s_lcdProf[LCD_PROF_IDS];
+
+/*------------------------------------- FUNCTION Definitions --------------------------------------*/
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_profInit
+[Description] :	This function is responsible for starting Timer0 and clearing the table, the application enables
+				the interrupts after it
+
+[Args] : This function takes no arguments
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+void LCD_profInit(void)
+{
+	TIMER0_init();
+	LCD_profClear();
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_profClear
+[Description] :	This function is responsible for clearing the statistics of all the functions
+
+[Args] : This function takes no arguments
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+void LCD_profClear(void)
+{
+	uint8 id;
+	uint8 loop;
+
+	for (id=0;id<LCD_PROF_IDS;id++)
+	{
+		g_s_lcdProf[id].s_count = 0;
+		g_s_lcdProf[id].s_min = 0xFFFF;
+		g_s_lcdProf[id].s_max = 0;
+		g_s_lcdProf[id].s_sum = 0;
+		for (loop=0;loop<LCD_PROF_BUCKETS;loop++)
+		{
+			g_s_lcdProf[id].s_hist[loop] = 0;
+		}
+	}
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_profRecord
+[Description] :	This function is responsible for adding one call to the statistics of a function, the bucket is the
+				position of the highest set bit of the latency
+
+[Args] :
+[in] uint8 a_id, uint16 a_start:
+a_id: the function, LCD_PROF_WRITE for example
+a_start: TIMER0_ticks at the function entry
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+void LCD_profRecord(uint8 a_id, uint16 a_start)
+{
+	uint16 ticks = TIMER0_ticks() - a_start;
+	LcdProfEntry* entry_Ptr;
+	uint8 bucket = 0;
+	uint16 rest = ticks;
+
+	if (a_id >= LCD_PROF_IDS)
+	{
+		return;
+	}
+	entry_Ptr = &g_s_lcdProf[a_id];
+	if (entry_Ptr->s_count == 0xFFFF)
+	{
+		/* the mean stays meaningful, the statistics are full */
+		return;
+	}
+	entry_Ptr->s_count++;
+	entry_Ptr->s_sum += ticks;
+	if (ticks < entry_Ptr->s_min)
+	{
+		entry_Ptr->s_min = ticks;
+	}
+	if (ticks > entry_Ptr->s_max)
+	{
+		entry_Ptr->s_max = ticks;
+	}
+	while ((rest > 1) && (bucket < (LCD_PROF_BUCKETS - 1)))
+	{
+		rest >>= 1;
+		bucket++;
+	}
+	entry_Ptr->s_hist[bucket]++;
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_profEntry
+[Description] :	This function is responsible for returning the statistics of a function
+
+[Args] :
+[in] uint8 a_id:
+a_id: the function, LCD_PROF_WRITE for example
+[Returns] : pointer to the statistics, or 0 if a_id is not a profiled function
+--------------------------------------------------------------------------------------------------------------- */
+const LcdProfEntry* LCD_profEntry(uint8 a_id)
+{
+	if (a_id >= LCD_PROF_IDS)
+	{
+		return 0;
+	}
+	return &g_s_lcdProf[a_id];
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_profMean
+[Description] :	This function is responsible for returning the mean latency of a function
+
+[Args] :
+[in] uint8 a_id:
+a_id: the function, LCD_PROF_WRITE for example
+[Returns] : The mean latency in ticks, 0 if it is not called yet
+--------------------------------------------------------------------------------------------------------------- */
+uint16 LCD_profMean(uint8 a_id)
+{
+	if ((a_id >= LCD_PROF_IDS) || (g_s_lcdProf[a_id].s_count == 0))
+	{
+		return 0;
+	}
+	return (uint16)(g_s_lcdProf[a_id].s_sum / g_s_lcdProf[a_id].s_count);
+}
@@ -0,0 +1,120 @@
+/* --------------------------------------------------------------------------------------------------
+[FILE NAME]:		<lcd_prof.h>
+[AUTHOR(S)]:		<Ayman Younis>
+[DATE CREATED]:		<18/10/2026>
+[DESCRIPTION]:		This file contains the lcd latency profiler header file. When lcd.c is built with LCD_PROFILE
+*					defined, the entry and exit of LCD_write, LCD_displayString, LCD_goToRowColumn,
+*					LCD_clearScreen and LCD_displayNumber are timestamped with the free running Timer0 of timer.h,
+*					and each function gets the minimum, maximum and mean latency and a histogram of the calls,
+*					bucket b counting the calls of 2^b to 2^(b+1)-1 ticks.
+*
+*					Build lcd.c, lcd_prof.c and timer.c with LCD_PROFILE defined, call LCD_profInit then enable the
+*					interrupts. The table takes LCD_PROF_IDS * (10 + 2 * LCD_PROF_BUCKETS) bytes of RAM, the application dumps
+*					it with LCD_profEntry. Nested calls (LCD_write inside LCD_displayString) are measured each.
+-------------------------------------------------------------------------------------------------- */
+
+/*	LCD_PROF_H_MAIN will be defined at the lcd profiler source file only, so the EXTERN will be removed, also
+*   EXTERN becomes extern in other files that include lcd_prof.h
+*/
+#ifdef LCD_PROF_H_MAIN
+#define EXTERN
+#else
+#define EXTERN extern
+#endif
+
+#ifndef LCD_PROF_H_
+#define LCD_PROF_H_
+
+/*--------------------------------------------- INCLUDES -------------------------------------------*/
+#include "timer.h"
+
+/*---------------------------------- Definitions and configurations --------------------------------*/
+/*	profiled functions */
+#define LCD_PROF_WRITE			0						/**< LCD_write, one queued write and its flush	*/
+#define LCD_PROF_STRING			1						/**< LCD_displayStringInst						*/
+#define LCD_PROF_GOTO			2						/**< LCD_goToRowColumnInst						*/
+#define LCD_PROF_CLEAR			3						/**< LCD_clearScreenInst						*/
+#define LCD_PROF_NUMBER			4						/**< LCD_displayNumberInst, LCD_displayFixedInst	*/
+#define LCD_PROF_IDS			5
+
+/*	histogram buckets of each function, the last one counts all the longer calls */
+#define LCD_PROF_BUCKETS		10
+
+/*	used at the entry (after the local variables) and at the exit of the profiled functions of lcd.c */
+#define LCD_PROF_BEGIN()		uint16 profStart = TIMER0_ticks()
+#define LCD_PROF_END(a_id)		LCD_profRecord((a_id), profStart)
+
+/*-------------------------------------- Structures and Unions ---------------------------------------*/
+/* ---------------------------------------------------------------------------------------------------
+[Structure Name]: LcdProfEntry
+[Structure Description]: This structure is the latency statistics of one function, in Timer0 ticks:
+								1. s_count: number of calls, it stops at 65535
+								2. s_min, s_max: shortest and longest call
+								3. s_sum: total time of the calls, the mean is s_sum / s_count
+								4. s_hist: number of calls of each bucket
+---------------------------------------------------------------------------------------------------- */
+typedef struct
+{
+	uint16 s_count;
+	uint16 s_min;
+	uint16 s_max;
+	uint32 s_sum;
+	uint16 s_hist[LCD_PROF_BUCKETS];
+}LcdProfEntry;
+
+/*----------------------------------- FUNCTION DECLARATIONS ----------------------------------------------------*/
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_profInit
+[Description] :	This function is responsible for starting Timer0 and clearing the table, the application enables
+				the interrupts after it
+
+[Args] : This function takes no arguments
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+EXTERN void LCD_profInit(void);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_profClear
+[Description] :	This function is responsible for clearing the statistics of all the functions
+
+[Args] : This function takes no arguments
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+EXTERN void LCD_profClear(void);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_profRecord
+[Description] :	This function is responsible for adding one call to the statistics of a function
+
+[Args] :
+[in] uint8 a_id, uint16 a_start:
+a_id: the function, LCD_PROF_WRITE for example
+a_start: TIMER0_ticks at the function entry
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+EXTERN void LCD_profRecord(uint8 a_id, uint16 a_start);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_profEntry
+[Description] :	This function is responsible for returning the statistics of a function, TIMER0_TICKS_TO_US converts
+				them to micro seconds
+
+[Args] :
+[in] uint8 a_id:
+a_id: the function, LCD_PROF_WRITE for example
+[Returns] : pointer to the statistics, or 0 if a_id is not a profiled function
+--------------------------------------------------------------------------------------------------------------- */
+EXTERN const LcdProfEntry* LCD_profEntry(uint8 a_id);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_profMean
+[Description] :	This function is responsible for returning the mean latency of a function
+
+[Args] :
+[in] uint8 a_id:
+a_id: the function, LCD_PROF_WRITE for example
+[Returns] : The mean latency in ticks, 0 if it is not called yet
+--------------------------------------------------------------------------------------------------------------- */
+EXTERN uint16 LCD_profMean(uint8 a_id);
+
+#endif /* LCD_PROF_H_ */
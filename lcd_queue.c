@@ -0,0 +1,159 @@
+/* --------------------------------------------------------------------------------------------------
+[FILE NAME]:		<lcd_queue.c>
+[AUTHOR(S)]:		<Ayman Younis>
+[DATE CREATED]:		<18/10/2026>
+[DESCRIPTION]:		This file contains the lcd update queue source file, a lock-free single producer/single consumer
+*					queue used to post display updates from interrupt context.
+[USAGE]:			<See the C include lcd_queue.h file for a description of each function>
+-------------------------------------------------------------------------------------------------- */
+
+/*--------------------------------------------- INCLUDES ------------------------------------------*/
+#define LCD_QUEUE_H_MAIN
+#include "lcd_queue.h"
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_queuePost
+[Description] :	This function is responsible for reserving the next free item of the queue for the producer, it
+				counts the overflow if the queue is full and updates the high-water mark
+
+[Args] :
+[in] LcdQueue* a_queue_Ptr:
+a_queue_Ptr: pointer to the queue
+[Returns] : pointer to the free item or 0 if the queue is full
+--------------------------------------------------------------------------------------------------------------- */
+static LcdQueueItem* LCD_queuePost(LcdQueue* a_queue_Ptr);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_queuePublish
+[Description] :	This function is responsible for making the item reserved by LCD_queuePost visible to the consumer
+
+[Args] :
+[in] LcdQueue* a_queue_Ptr:
+a_queue_Ptr: pointer to the queue
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+static void LCD_queuePublish(LcdQueue* a_queue_Ptr);
+
+/*------------------------------------- FUNCTION Definitions --------------------------------------*/
+/*------------------------------------------ LCD_queueInit -----------------------------------------*/
+void LCD_queueInit(LcdQueue* a_queue_Ptr)
+{
+	a_queue_Ptr->s_head			= 0;
+	a_queue_Ptr->s_tail			= 0;
+	a_queue_Ptr->s_overflows	= 0;
+	a_queue_Ptr->s_highWater	= 0;
+	a_queue_Ptr->s_lane			= LCD_LANE_BACKGROUND;
+}
+
+/*----------------------------------------- LCD_queueSetLane ---------------------------------------*/
+void LCD_queueSetLane(LcdQueue* a_queue_Ptr, uint8 a_lane)
+{
+	a_queue_Ptr->s_lane = a_lane;
+}
+
+/*---------------------------------------- LCD_queuePostCell ---------------------------------------*/
+uint8 LCD_queuePostCell(LcdQueue* a_queue_Ptr, uint8 a_row, uint8 a_col, uint8 a_dataCharacter)
+{
+	LcdQueueItem* item_Ptr = LCD_queuePost(a_queue_Ptr);
+	
+	if (item_Ptr == 0)
+	{
+		return 0;
+	}
+	item_Ptr->s_type	= LCD_QUEUE_CELL;
+	item_Ptr->s_row		= a_row;
+	item_Ptr->s_col		= a_col;
+	item_Ptr->s_char	= a_dataCharacter;
+	LCD_queuePublish(a_queue_Ptr);
+	return 1;
+}
+
+/*--------------------------------------- LCD_queuePostString --------------------------------------*/
+uint8 LCD_queuePostString(LcdQueue* a_queue_Ptr, uint8 a_row, uint8 a_col, const uint8* a_str_Ptr)
+{
+	LcdQueueItem* item_Ptr = LCD_queuePost(a_queue_Ptr);
+	
+	if (item_Ptr == 0)
+	{
+		return 0;
+	}
+	item_Ptr->s_type	= LCD_QUEUE_STRING;
+	item_Ptr->s_row		= a_row;
+	item_Ptr->s_col		= a_col;
+	item_Ptr->s_str_Ptr	= a_str_Ptr;
+	LCD_queuePublish(a_queue_Ptr);
+	return 1;
+}
+
+/*----------------------------------------- LCD_queueDrain -----------------------------------------*/
+uint8 LCD_queueDrain(LcdQueue* a_queue_Ptr, Lcd* a_lcd_Ptr, uint8 a_maxItems)
+{
+	uint8 drained = 0;
+	uint8 lane = a_lcd_Ptr->s_lane;
+	LcdQueueItem* item_Ptr;
+	
+	LCD_beginBatch();
+	LCD_setLaneInst(a_lcd_Ptr, a_queue_Ptr->s_lane);
+	/* s_head is read once per item, an ISR posting meanwhile is drained by the next call */
+	while ((drained < a_maxItems) && (a_queue_Ptr->s_tail != a_queue_Ptr->s_head))
+	{
+		item_Ptr = & a_queue_Ptr->s_items[a_queue_Ptr->s_tail & (LCD_QUEUE_DEPTH - 1)];
+		if (item_Ptr->s_type == LCD_QUEUE_CELL)
+		{
+			LCD_goToRowColumnInst(a_lcd_Ptr, item_Ptr->s_row, item_Ptr->s_col);
+			LCD_displayCharacterInst(a_lcd_Ptr, item_Ptr->s_char);
+		}
+		else
+		{
+			LCD_displayStringRowColumnInst(a_lcd_Ptr, item_Ptr->s_row, item_Ptr->s_col, item_Ptr->s_str_Ptr);
+		}
+		/* the item is read completely before it is given back to the producer */
+		LCD_QUEUE_BARRIER();
+		a_queue_Ptr->s_tail++;
+		drained++;
+	}
+	LCD_setLaneInst(a_lcd_Ptr, lane);
+	LCD_endBatch();
+	return drained;
+}
+
+/*--------------------------------------- LCD_queueOverflows ---------------------------------------*/
+uint8 LCD_queueOverflows(const LcdQueue* a_queue_Ptr)
+{
+	return a_queue_Ptr->s_overflows;
+}
+
+/*--------------------------------------- LCD_queueHighWater ---------------------------------------*/
+uint8 LCD_queueHighWater(const LcdQueue* a_queue_Ptr)
+{
+	return a_queue_Ptr->s_highWater;
+}
+
+/*----------------------------------------- LCD_queuePost ------------------------------------------*/
+static LcdQueueItem* LCD_queuePost(LcdQueue* a_queue_Ptr)
+{
+	/* s_head and s_tail are free running counters, their difference is the number of queued items */
+	uint8 count = (uint8)(a_queue_Ptr->s_head - a_queue_Ptr->s_tail);
+	
+	if (count >= LCD_QUEUE_DEPTH)
+	{
+		if (a_queue_Ptr->s_overflows != 0xFF)
+		{
+			a_queue_Ptr->s_overflows++;
+		}
+		return 0;
+	}
+	if (count >= a_queue_Ptr->s_highWater)
+	{
+		a_queue_Ptr->s_highWater = count + 1;
+	}
+	return & a_queue_Ptr->s_items[a_queue_Ptr->s_head & (LCD_QUEUE_DEPTH - 1)];
+}
+
+/*---------------------------------------- LCD_queuePublish ----------------------------------------*/
+static void LCD_queuePublish(LcdQueue* a_queue_Ptr)
+{
+	/* the item is written completely before the consumer can see it */
+	LCD_QUEUE_BARRIER();
+	a_queue_Ptr->s_head++;
+}
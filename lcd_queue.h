@@ -0,0 +1,175 @@
+/* --------------------------------------------------------------------------------------------------
+[FILE NAME]:		<lcd_queue.h>
+[AUTHOR(S)]:		<Ayman Younis>
+[DATE CREATED]:		<18/10/2026>
+[DESCRIPTION]:		This file contains the lcd update queue header file, a lock-free single producer/single consumer
+*					queue used to post display updates from interrupt context.
+*
+*					The LCD functions can't be called from an ISR, they block for the execution time of the
+*					controller and would break a write already in progress in the main loop. The ISR posts the
+*					update in constant time instead, and the main loop (or a timer ISR which doesn't interrupt the
+*					main loop LCD calls) drains the queue into the LCD.
+*
+*					The producer only writes s_head and the consumer only writes s_tail, both are one byte so they
+*					are read and written atomically by the AVR and no interrupt needs to be disabled.
+*					All the ISRs together are one producer as long as they don't nest (the AVR default), the main
+*					loop must not post to a queue drained by itself inside an LCD call.
+-------------------------------------------------------------------------------------------------- */
+
+/*	LCD_QUEUE_H_MAIN will be defined at the lcd queue source file only, so the EXTERN will be removed, also
+*   EXTERN becomes extern in other files that include lcd_queue.h
+*/
+#ifdef LCD_QUEUE_H_MAIN
+#define EXTERN
+#else
+#define EXTERN extern
+#endif
+
+#ifndef LCD_QUEUE_H_
+#define LCD_QUEUE_H_
+
+/*--------------------------------------------- INCLUDES -------------------------------------------*/
+#include "lcd.h"
+
+/*---------------------------------- Definitions and configurations --------------------------------*/
+/*	number of updates the queue can hold, must be a power of two and not more than 128 */
+#define LCD_QUEUE_DEPTH			16
+
+/*	types of the queued updates */
+#define LCD_QUEUE_CELL			0						/**< one character at row, column			*/
+#define LCD_QUEUE_STRING		1						/**< string at row, column					*/
+
+/*	compiler barrier, keeps the item writes/reads before the index update which publishes/frees it */
+#define LCD_QUEUE_BARRIER()		__asm__ __volatile__ ("" ::: "memory")
+
+/*-------------------------------------- Structures and Unions ---------------------------------------*/
+/* ---------------------------------------------------------------------------------------------------
+[Structure Name]: LcdQueueItem
+[Structure Description]: This structure describes one posted display update:
+								1. s_type: LCD_QUEUE_CELL or LCD_QUEUE_STRING
+								2. s_row, s_col: position of the update on the display
+								3. s_char: the character of a cell update
+								4. s_str_Ptr: the string of a string update, it must stay valid till it is drained
+---------------------------------------------------------------------------------------------------- */
+typedef struct
+{
+	uint8 s_type;
+	uint8 s_row;
+	uint8 s_col;
+	uint8 s_char;
+	const uint8* s_str_Ptr;
+}LcdQueueItem;
+
+/* ---------------------------------------------------------------------------------------------------
+[Structure Name]: LcdQueue
+[Structure Description]: This structure is the update queue of one display:
+								1. s_items: the circular buffer of the updates
+								2. s_head: number of posted updates, written by the producer only
+								3. s_tail: number of drained updates, written by the consumer only
+								4. s_overflows: number of updates dropped because the queue was full
+								5. s_highWater: maximum number of updates the queue held at the same time
+								6. s_lane: lane of the display writes of the drained updates
+---------------------------------------------------------------------------------------------------- */
+typedef struct
+{
+	LcdQueueItem s_items[LCD_QUEUE_DEPTH];
+	volatile uint8 s_head;
+	volatile uint8 s_tail;
+	volatile uint8 s_overflows;
+	volatile uint8 s_highWater;
+	uint8 s_lane;
+}LcdQueue;
+
+/*----------------------------------- FUNCTION DECLARATIONS ----------------------------------------------------*/
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_queueInit
+[Description] :	This function is responsible for emptying the queue and clearing its statistics, it must be called
+				before the interrupts which post to the queue are enabled
+
+[Args] :
+[in] LcdQueue* a_queue_Ptr:
+a_queue_Ptr: pointer to the queue
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+EXTERN void LCD_queueInit(LcdQueue* a_queue_Ptr);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_queueSetLane
+[Description] :	This function is responsible for choosing the lane of the display writes of the drained updates, 
+				LCD_LANE_BACKGROUND by default. A queue of alarms drained by the preempt hook (LCD_setPreemptHook)
+				in the urgent lane is shown before the rest of a background repaint in progress
+
+[Args] :
+[in] LcdQueue* a_queue_Ptr, uint8 a_lane:
+a_queue_Ptr: pointer to the queue
+a_lane: LCD_LANE_BACKGROUND or LCD_LANE_URGENT
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+EXTERN void LCD_queueSetLane(LcdQueue* a_queue_Ptr, uint8 a_lane);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_queuePostCell
+[Description] :	This function is responsible for posting one character update, it can be called from an ISR and
+				takes constant time
+
+[Args] :
+[in] LcdQueue* a_queue_Ptr, uint8 a_row, uint8 a_col, uint8 a_dataCharacter:
+a_queue_Ptr: pointer to the queue
+a_row, a_col: position of the character
+a_dataCharacter: the character to be displayed
+[Returns] : 1 if the update is posted or 0 if the queue is full and the update is dropped
+--------------------------------------------------------------------------------------------------------------- */
+EXTERN uint8 LCD_queuePostCell(LcdQueue* a_queue_Ptr, uint8 a_row, uint8 a_col, uint8 a_dataCharacter);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_queuePostString
+[Description] :	This function is responsible for posting one string update, it can be called from an ISR and takes
+				constant time, only the pointer is queued so the string must stay valid till it is drained
+
+[Args] :
+[in] LcdQueue* a_queue_Ptr, uint8 a_row, uint8 a_col, const uint8* a_str_Ptr:
+a_queue_Ptr: pointer to the queue
+a_row, a_col: position of the first character
+a_str_Ptr: pointer to the string to be displayed
+[Returns] : 1 if the update is posted or 0 if the queue is full and the update is dropped
+--------------------------------------------------------------------------------------------------------------- */
+EXTERN uint8 LCD_queuePostString(LcdQueue* a_queue_Ptr, uint8 a_row, uint8 a_col, const uint8* a_str_Ptr);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_queueDrain
+[Description] :	This function is responsible for writing the posted updates to the display, in the order they were
+				posted, the updates are written in one batch so the writes of different controllers are overlapped
+
+[Args] :
+[in] LcdQueue* a_queue_Ptr, Lcd* a_lcd_Ptr, uint8 a_maxItems:
+a_queue_Ptr: pointer to the queue
+a_lcd_Ptr: pointer to the display handle
+a_maxItems: maximum number of updates to be written by this call
+[Returns] : The number of updates written
+--------------------------------------------------------------------------------------------------------------- */
+EXTERN uint8 LCD_queueDrain(LcdQueue* a_queue_Ptr, Lcd* a_lcd_Ptr, uint8 a_maxItems);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_queueOverflows
+[Description] :	This function is responsible for returning the number of dropped updates, it stops at 255
+
+[Args] :
+[in] const LcdQueue* a_queue_Ptr:
+a_queue_Ptr: pointer to the queue
+[Returns] : The number of updates dropped because the queue was full
+--------------------------------------------------------------------------------------------------------------- */
+EXTERN uint8 LCD_queueOverflows(const LcdQueue* a_queue_Ptr);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_queueHighWater
+[Description] :	This function is responsible for returning the maximum number of updates the queue held at the same
+				time since LCD_queueInit, it shows if LCD_QUEUE_DEPTH is big enough
+
+[Args] :
+[in] const LcdQueue* a_queue_Ptr:
+a_queue_Ptr: pointer to the queue
+[Returns] : The high-water mark of the queue
+--------------------------------------------------------------------------------------------------------------- */
+EXTERN uint8 LCD_queueHighWater(const LcdQueue* a_queue_Ptr);
+
+#endif /* LCD_QUEUE_H_ */
@@ -0,0 +1,144 @@
+/* --------------------------------------------------------------------------------------------------
+[FILE NAME]:		<lcd_screen.c>
+[AUTHOR(S)]:		<Ayman Younis>
+[DATE CREATED]:		<18/10/2026>
+[DESCRIPTION]:		This file contains the lcd screen manager source file, menu screens declared as constant
+*					layouts plus dynamic fields, shown with diffed transitions.
+[USAGE]:			<See the C include lcd_screen.h file for a description of each function>
+-------------------------------------------------------------------------------------------------- */
+
+/*--------------------------------------------- INCLUDES ------------------------------------------*/
+#define LCD_SCREEN_H_MAIN
+#include "lcd_screen.h"
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_screenDraw
+[Description] :	This function is responsible for composing a screen in the frame buffer of the display: its base
+				screens first, then its texts and its dynamic fields, and writing the changed cells
+
+[Args] :
+[in] Lcd* a_lcd_Ptr, const LcdScreen* a_screen_Ptr:
+a_lcd_Ptr: pointer to the display handle
+a_screen_Ptr: the screen
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+static void LCD_screenDraw(Lcd* a_lcd_Ptr, const LcdScreen* a_screen_Ptr);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_screenLayer
+[Description] :	This function is responsible for drawing a screen on top of its base screens
+
+[Args] :
+[in] Lcd* a_lcd_Ptr, const LcdScreen* a_screen_Ptr:
+a_lcd_Ptr: pointer to the display handle
+a_screen_Ptr: the screen
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+static void LCD_screenLayer(Lcd* a_lcd_Ptr, const LcdScreen* a_screen_Ptr);
+
+/*------------------------------------- FUNCTION Definitions --------------------------------------*/
+/*----------------------------------------- LCD_screenInit -----------------------------------------*/
+void LCD_screenInit(LcdScreenManager* a_manager_Ptr, Lcd* a_lcd_Ptr)
+{
+	a_manager_Ptr->s_lcd_Ptr	= a_lcd_Ptr;
+	a_manager_Ptr->s_depth		= 0;
+}
+
+/*----------------------------------------- LCD_screenShow -----------------------------------------*/
+void LCD_screenShow(LcdScreenManager* a_manager_Ptr, const LcdScreen* a_screen_Ptr)
+{
+	if (a_manager_Ptr->s_depth == 0)
+	{
+		a_manager_Ptr->s_depth = 1;
+	}
+	a_manager_Ptr->s_stack[a_manager_Ptr->s_depth - 1] = a_screen_Ptr;
+	LCD_screenDraw(a_manager_Ptr->s_lcd_Ptr, a_screen_Ptr);
+}
+
+/*----------------------------------------- LCD_screenPush -----------------------------------------*/
+void LCD_screenPush(LcdScreenManager* a_manager_Ptr, const LcdScreen* a_screen_Ptr)
+{
+	uint8 loop;
+
+	if (a_manager_Ptr->s_depth == LCD_SCREEN_DEPTH)
+	{
+		for (loop=1;loop<LCD_SCREEN_DEPTH;loop++)
+		{
+			a_manager_Ptr->s_stack[loop - 1] = a_manager_Ptr->s_stack[loop];
+		}
+		a_manager_Ptr->s_depth--;
+	}
+	a_manager_Ptr->s_stack[a_manager_Ptr->s_depth++] = a_screen_Ptr;
+	LCD_screenDraw(a_manager_Ptr->s_lcd_Ptr, a_screen_Ptr);
+}
+
+/*----------------------------------------- LCD_screenBack -----------------------------------------*/
+uint8 LCD_screenBack(LcdScreenManager* a_manager_Ptr)
+{
+	if (a_manager_Ptr->s_depth < 2)
+	{
+		return 0;
+	}
+	a_manager_Ptr->s_depth--;
+	LCD_screenDraw(a_manager_Ptr->s_lcd_Ptr, a_manager_Ptr->s_stack[a_manager_Ptr->s_depth - 1]);
+	return 1;
+}
+
+/*---------------------------------------- LCD_screenRefresh ---------------------------------------*/
+void LCD_screenRefresh(LcdScreenManager* a_manager_Ptr)
+{
+	if (a_manager_Ptr->s_depth != 0)
+	{
+		LCD_screenDraw(a_manager_Ptr->s_lcd_Ptr, a_manager_Ptr->s_stack[a_manager_Ptr->s_depth - 1]);
+	}
+}
+
+/*---------------------------------------- LCD_screenCurrent ---------------------------------------*/
+const LcdScreen* LCD_screenCurrent(const LcdScreenManager* a_manager_Ptr)
+{
+	if (a_manager_Ptr->s_depth == 0)
+	{
+		return 0;
+	}
+	return a_manager_Ptr->s_stack[a_manager_Ptr->s_depth - 1];
+}
+
+/*----------------------------------------- LCD_screenDraw ----------------------------------------*/
+static void LCD_screenDraw(Lcd* a_lcd_Ptr, const LcdScreen* a_screen_Ptr)
+{
+	/* with a frame the clear only blanks the back buffer, the commit writes the difference */
+	LCD_beginFrameInst(a_lcd_Ptr);
+	LCD_clearScreenInst(a_lcd_Ptr);
+	LCD_screenLayer(a_lcd_Ptr, a_screen_Ptr);
+	LCD_commitFrameInst(a_lcd_Ptr);
+}
+
+/*----------------------------------------- LCD_screenLayer ---------------------------------------*/
+static void LCD_screenLayer(Lcd* a_lcd_Ptr, const LcdScreen* a_screen_Ptr)
+{
+	const LcdScreen* base_Ptr = (const LcdScreen*)FLASH_READ_PTR(&a_screen_Ptr->s_base_Ptr);
+	const LcdScreenText* text_Ptr = (const LcdScreenText*)FLASH_READ_PTR(&a_screen_Ptr->s_texts_Ptr);
+	void (*fields_Ptr)(Lcd* a_lcd_Ptr) = (void (*)(Lcd*))FLASH_READ_PTR(&a_screen_Ptr->s_fields_Ptr);
+	uint8 texts = FLASH_READ_BYTE(&a_screen_Ptr->s_texts);
+	const uint8* str_Ptr;
+	uint8 character;
+	uint8 loop;
+
+	if (base_Ptr != 0)
+	{
+		LCD_screenLayer(a_lcd_Ptr, base_Ptr);
+	}
+	for (loop=0;loop<texts;loop++)
+	{
+		LCD_goToRowColumnInst(a_lcd_Ptr, FLASH_READ_BYTE(&text_Ptr[loop].s_row), FLASH_READ_BYTE(&text_Ptr[loop].s_col));
+		str_Ptr = (const uint8*)FLASH_READ_PTR(&text_Ptr[loop].s_str_Ptr);
+		while ((character = FLASH_READ_BYTE(str_Ptr++)) != '\0')
+		{
+			LCD_displayCharacterInst(a_lcd_Ptr, character);
+		}
+	}
+	if (fields_Ptr != 0)
+	{
+		fields_Ptr(a_lcd_Ptr);
+	}
+}
@@ -0,0 +1,165 @@
+/* --------------------------------------------------------------------------------------------------
+[FILE NAME]:		<lcd_screen.h>
+[AUTHOR(S)]:		<Ayman Younis>
+[DATE CREATED]:		<18/10/2026>
+[DESCRIPTION]:		This file contains the lcd screen manager header file, menu screens declared as constant
+*					layouts plus dynamic fields, shown with diffed transitions.
+*
+*					A screen is a table of constant texts, an optional base screen drawn before it (the header and
+*					footer shared by many menus) and an optional function drawing its dynamic fields. The screens,
+*					their text tables and the strings are FLASH_CONST so the menus take no RAM:
+*
+*						static const uint8 s_title[] FLASH_CONST = "Settings";
+*						static const LcdScreenText s_texts[] FLASH_CONST = {{0, 4, s_title}};
+*						static const LcdScreen s_settings FLASH_CONST = {&s_main, s_texts, LCD_SCREEN_TEXTS(s_texts), 0};
+*
+*					A transition
+*					composes the incoming screen in the frame buffer of the display between LCD_beginFrameInst
+*					and LCD_commitFrameInst, so only the cells which differ from the outgoing screen are written:
+*					a shared header costs nothing and a menu move is a few bytes instead of a full repaint.
+*
+*					The display should have a frame attached (LCD_attachFrameInst before LCD_initInst), without
+*					it each transition clears the display and draws the whole screen.
+-------------------------------------------------------------------------------------------------- */
+
+/*	LCD_SCREEN_H_MAIN will be defined at the lcd screen source file only, so the EXTERN will be removed, also
+*   EXTERN becomes extern in other files that include lcd_screen.h
+*/
+#ifdef LCD_SCREEN_H_MAIN
+#define EXTERN
+#else
+#define EXTERN extern
+#endif
+
+#ifndef LCD_SCREEN_H_
+#define LCD_SCREEN_H_
+
+/*--------------------------------------------- INCLUDES -------------------------------------------*/
+#include "lcd.h"
+#include "flash_mem.h"
+
+/*---------------------------------- Definitions and configurations --------------------------------*/
+/*	screens kept by LCD_screenPush to go back to */
+#define LCD_SCREEN_DEPTH		8
+
+/*	number of texts of a constant table */
+#define LCD_SCREEN_TEXTS(a_table)	((uint8)(sizeof(a_table) / sizeof((a_table)[0])))
+
+/*-------------------------------------- Structures and Unions ---------------------------------------*/
+/* ---------------------------------------------------------------------------------------------------
+[Structure Name]: LcdScreenText
+[Structure Description]: This structure is one constant text of a screen layout, in a FLASH_CONST table:
+								1. s_row, s_col: position of the first character
+								2. s_str_Ptr: the text, a FLASH_CONST string
+---------------------------------------------------------------------------------------------------- */
+typedef struct
+{
+	uint8 s_row;
+	uint8 s_col;
+	const uint8* s_str_Ptr;
+}LcdScreenText;
+
+/* ---------------------------------------------------------------------------------------------------
+[Structure Name]: LcdScreen
+[Structure Description]: This structure is one screen, it is declared FLASH_CONST:
+								1. s_base_Ptr: screen drawn before this one (shared header and footer), or 0
+								2. s_texts_Ptr, s_texts: the FLASH_CONST table of texts and their number
+								3. s_fields_Ptr: function drawing the dynamic fields with the usual LCD functions
+								   after the texts, or 0
+---------------------------------------------------------------------------------------------------- */
+typedef struct LcdScreen
+{
+	const struct LcdScreen* s_base_Ptr;
+	const LcdScreenText* s_texts_Ptr;
+	uint8 s_texts;
+	void (*s_fields_Ptr)(Lcd* a_lcd_Ptr);
+}LcdScreen;
+
+/* ---------------------------------------------------------------------------------------------------
+[Structure Name]: LcdScreenManager
+[Structure Description]: This structure is the screen manager of one display:
+								1. s_lcd_Ptr: the display
+								2. s_stack: the screens to go back to, s_stack[s_depth - 1] is the shown one
+								3. s_depth: number of screens in s_stack, 0 before the first one is shown
+---------------------------------------------------------------------------------------------------- */
+typedef struct
+{
+	Lcd* s_lcd_Ptr;
+	const LcdScreen* s_stack[LCD_SCREEN_DEPTH];
+	uint8 s_depth;
+}LcdScreenManager;
+
+/*----------------------------------- FUNCTION DECLARATIONS ----------------------------------------------------*/
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_screenInit
+[Description] :	This function is responsible for initializing the screen manager of a display, nothing is shown
+
+[Args] :
+[in] LcdScreenManager* a_manager_Ptr, Lcd* a_lcd_Ptr:
+a_manager_Ptr: pointer to the screen manager
+a_lcd_Ptr: pointer to the display handle
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+EXTERN void LCD_screenInit(LcdScreenManager* a_manager_Ptr, Lcd* a_lcd_Ptr);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_screenShow
+[Description] :	This function is responsible for replacing the shown screen by another one, the screens to go back
+				to are kept
+
+[Args] :
+[in] LcdScreenManager* a_manager_Ptr, const LcdScreen* a_screen_Ptr:
+a_manager_Ptr: pointer to the screen manager
+a_screen_Ptr: the incoming screen
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+EXTERN void LCD_screenShow(LcdScreenManager* a_manager_Ptr, const LcdScreen* a_screen_Ptr);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_screenPush
+[Description] :	This function is responsible for showing a screen entered from the shown one (a sub-menu), if
+				LCD_SCREEN_DEPTH screens are kept already the oldest one is forgotten
+
+[Args] :
+[in] LcdScreenManager* a_manager_Ptr, const LcdScreen* a_screen_Ptr:
+a_manager_Ptr: pointer to the screen manager
+a_screen_Ptr: the incoming screen
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+EXTERN void LCD_screenPush(LcdScreenManager* a_manager_Ptr, const LcdScreen* a_screen_Ptr);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_screenBack
+[Description] :	This function is responsible for showing again the screen the shown one was pushed from
+
+[Args] :
+[in] LcdScreenManager* a_manager_Ptr:
+a_manager_Ptr: pointer to the screen manager
+[Returns] : 1 if the previous screen is shown, 0 if there is no screen to go back to
+--------------------------------------------------------------------------------------------------------------- */
+EXTERN uint8 LCD_screenBack(LcdScreenManager* a_manager_Ptr);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_screenRefresh
+[Description] :	This function is responsible for drawing the shown screen again, so the cells of its dynamic fields
+				which changed are written
+
+[Args] :
+[in] LcdScreenManager* a_manager_Ptr:
+a_manager_Ptr: pointer to the screen manager
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+EXTERN void LCD_screenRefresh(LcdScreenManager* a_manager_Ptr);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_screenCurrent
+[Description] :	This function is responsible for returning the shown screen
+
+[Args] :
+[in] const LcdScreenManager* a_manager_Ptr:
+a_manager_Ptr: pointer to the screen manager
+[Returns] : The shown screen, or 0 if none is shown yet
+--------------------------------------------------------------------------------------------------------------- */
+EXTERN const LcdScreen* LCD_screenCurrent(const LcdScreenManager* a_manager_Ptr);
+
+#endif /* LCD_SCREEN_H_ */
@@ -0,0 +1,92 @@
+/* --------------------------------------------------------------------------------------------------
+[FILE NAME]:		<lcd_strpack.c>
+[AUTHOR(S)]:		<Ayman Younis>
+[DATE CREATED]:		<18/10/2026>
+[DESCRIPTION]:		This file contains the lcd packed strings source file, string tables compressed in the flash by
+*					lcd_strpack_tool.c and decoded while they are displayed.
+[USAGE]:			<See the C include lcd_strpack.h file for a description of each function>
+-------------------------------------------------------------------------------------------------- */
+
+/*--------------------------------------------- INCLUDES ------------------------------------------*/
+#define LCD_STRPACK_H_MAIN
+#include "lcd_strpack.h"
+
+/*------------------------------------- FUNCTION Definitions --------------------------------------*/
+/*----------------------------------------- LCD_strpackOpen ----------------------------------------*/
+void LCD_strpackOpen(LcdStrpackReader* a_reader_Ptr, const LcdStrpack* a_table_Ptr, uint16 a_index)
+{
+	/* the last string ends with the data, its terminator is the empty string of a wrong index */
+	uint16 offset = FLASH_READ_WORD(&a_table_Ptr->s_offsets_Ptr[a_table_Ptr->s_count]) - 1;
+
+	if (a_index < a_table_Ptr->s_count)
+	{
+		offset = FLASH_READ_WORD(&a_table_Ptr->s_offsets_Ptr[a_index]);
+	}
+	a_reader_Ptr->s_next_Ptr	= &a_table_Ptr->s_data_Ptr[offset];
+	a_reader_Ptr->s_tokens_Ptr	= a_table_Ptr->s_tokens_Ptr;
+	a_reader_Ptr->s_pairs_Ptr	= a_table_Ptr->s_pairs_Ptr;
+	a_reader_Ptr->s_lastToken	= a_table_Ptr->s_lastToken;
+	a_reader_Ptr->s_depth		= 0;
+}
+
+/*----------------------------------------- LCD_strpackNext ----------------------------------------*/
+uint8 LCD_strpackNext(LcdStrpackReader* a_reader_Ptr)
+{
+	uint8 code;
+	uint8 pair;
+	const uint8* pair_Ptr;
+
+	for (;;)
+	{
+		if (a_reader_Ptr->s_depth != 0)
+		{
+			code = a_reader_Ptr->s_stack[--a_reader_Ptr->s_depth];
+		}
+		else
+		{
+			code = FLASH_READ_BYTE(a_reader_Ptr->s_next_Ptr);
+			if (code == '\0')
+			{
+				/* s_next_Ptr stays on the terminator */
+				return 0;
+			}
+			a_reader_Ptr->s_next_Ptr++;
+		}
+
+		if (code > a_reader_Ptr->s_lastToken)
+		{
+			return code;
+		}
+		pair = FLASH_READ_BYTE(&a_reader_Ptr->s_tokens_Ptr[code]);
+		if (pair == LCD_STRPACK_LITERAL)
+		{
+			return code;
+		}
+
+		/* the second code is decoded after the whole first one */
+		pair_Ptr = &a_reader_Ptr->s_pairs_Ptr[(uint16)pair * 2];
+		a_reader_Ptr->s_stack[a_reader_Ptr->s_depth++] = FLASH_READ_BYTE(pair_Ptr + 1);
+		a_reader_Ptr->s_stack[a_reader_Ptr->s_depth++] = FLASH_READ_BYTE(pair_Ptr);
+	}
+}
+
+/*------------------------------------- LCD_strpackDisplayInst -------------------------------------*/
+void LCD_strpackDisplayInst(Lcd* a_lcd_Ptr, const LcdStrpack* a_table_Ptr, uint16 a_index)
+{
+	LcdStrpackReader reader;
+	uint8 character;
+
+	LCD_strpackOpen(&reader, a_table_Ptr, a_index);
+	while ((character = LCD_strpackNext(&reader)) != '\0')
+	{
+		LCD_displayCharacterInst(a_lcd_Ptr, character);
+	}
+}
+
+/*--------------------------------- LCD_strpackDisplayRowColumnInst --------------------------------*/
+void LCD_strpackDisplayRowColumnInst(Lcd* a_lcd_Ptr, uint8 a_row, uint8 a_col, const LcdStrpack* a_table_Ptr,
+									 uint16 a_index)
+{
+	LCD_goToRowColumnInst(a_lcd_Ptr, a_row, a_col);
+	LCD_strpackDisplayInst(a_lcd_Ptr, a_table_Ptr, a_index);
+}
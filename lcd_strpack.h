@@ -0,0 +1,150 @@
+/* --------------------------------------------------------------------------------------------------
+[FILE NAME]:		<lcd_strpack.h>
+[AUTHOR(S)]:		<Ayman Younis>
+[DATE CREATED]:		<18/10/2026>
+[DESCRIPTION]:		This file contains the lcd packed strings header file, the UI string tables (menus, messages, one
+*					table per language) are kept compressed in the flash and decoded character by character while
+*					they are displayed, there is no RAM copy of a string.
+*
+*					The tables are generated at build time by lcd_strpack_tool.c with a byte pair encoding: the pairs
+*					of codes which are the most frequent in all the languages are replaced by a code which is not
+*					used by any string, again and again, so a token can stand for a whole word. The dictionary is
+*					shared by the languages of a table, the tokens are the lowest free codes so the table which
+*					tells them from the characters stops at the last one. A code is decoded with one flash read of
+*					s_tokens_Ptr and a token with two more of s_pairs_Ptr, so a character costs a few cycles of
+*					the CPU against the tens of microseconds of its bus write.
+*
+*					The codes of the packed strings are the bytes of the source strings, a table may hold UTF-8 text
+*					which is then given byte by byte to LCD_utf8DisplayByte (lcd_utf8.h) with LCD_strpackNext.
+-------------------------------------------------------------------------------------------------- */
+
+/*	LCD_STRPACK_H_MAIN will be defined at the lcd packed strings source file only, so the EXTERN will be removed,
+*   also EXTERN becomes extern in other files that include lcd_strpack.h
+*/
+#ifdef LCD_STRPACK_H_MAIN
+#define EXTERN
+#else
+#define EXTERN extern
+#endif
+
+#ifndef LCD_STRPACK_H_
+#define LCD_STRPACK_H_
+
+/*--------------------------------------------- INCLUDES -------------------------------------------*/
+#include "lcd.h"
+#include "flash_mem.h"
+
+/*---------------------------------- Definitions and configurations --------------------------------*/
+/*	the most tokens nested in a token, lcd_strpack_tool.c never builds deeper ones, the reader keeps one code
+*	more than this on its stack
+*/
+#define LCD_STRPACK_DEPTH		8
+
+/*	s_tokens_Ptr entry of a code which is a character */
+#define LCD_STRPACK_LITERAL		0xFF
+
+/*	the most tokens of a dictionary, a token is a code (1 to 255) which is not used by any string */
+#define LCD_STRPACK_TOKENS		255
+
+/*-------------------------------------- Structures and Unions ---------------------------------------*/
+/* ---------------------------------------------------------------------------------------------------
+[Structure Name]: LcdStrpack
+[Structure Description]: This structure is one language of a packed string table, generated by
+						 lcd_strpack_tool.c, the tables it points to are in the flash (FLASH_CONST):
+									1. s_tokens_Ptr, s_lastToken: for each code up to s_lastToken the index of its pair
+									   in s_pairs_Ptr, or LCD_STRPACK_LITERAL if the code is a character, the codes
+									   after s_lastToken are characters
+									2. s_pairs_Ptr: the two codes each token stands for
+									3. s_offsets_Ptr: index in s_data_Ptr of each string, then the size of s_data_Ptr
+									4. s_data_Ptr: the packed strings, each one is terminated by 0
+									5. s_count: number of strings
+---------------------------------------------------------------------------------------------------- */
+typedef struct
+{
+	const uint8* s_tokens_Ptr;
+	const uint8* s_pairs_Ptr;
+	const uint16* s_offsets_Ptr;
+	const uint8* s_data_Ptr;
+	uint16 s_count;
+	uint8 s_lastToken;
+}LcdStrpack;
+
+/* ---------------------------------------------------------------------------------------------------
+[Structure Name]: LcdStrpackReader
+[Structure Description]: This structure is the decoding state of one packed string:
+									1. s_next_Ptr: next code of the string in the flash
+									2. s_tokens_Ptr, s_pairs_Ptr, s_lastToken: the dictionary of the table
+									3. s_stack, s_depth: codes of the tokens being expanded, still to be decoded, the
+									   next one is s_stack[s_depth - 1]
+---------------------------------------------------------------------------------------------------- */
+typedef struct
+{
+	const uint8* s_next_Ptr;
+	const uint8* s_tokens_Ptr;
+	const uint8* s_pairs_Ptr;
+	uint8 s_lastToken;
+	uint8 s_stack[LCD_STRPACK_DEPTH + 1];
+	uint8 s_depth;
+}LcdStrpackReader;
+
+/*----------------------------------- FUNCTION DECLARATIONS ----------------------------------------------------*/
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_strpackOpen
+[Description] :	This function is responsible for starting the decoding of a packed string, an index out of the
+				table gives an empty string
+
+[Args] :
+[in] LcdStrpackReader* a_reader_Ptr, const LcdStrpack* a_table_Ptr, uint16 a_index:
+a_reader_Ptr: pointer to the decoding state
+a_table_Ptr: the packed string table of the language
+a_index: index of the string, the <NAME>_<ID> definition of the header generated with the table
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+EXTERN void LCD_strpackOpen(LcdStrpackReader* a_reader_Ptr, const LcdStrpack* a_table_Ptr, uint16 a_index);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_strpackNext
+[Description] :	This function is responsible for decoding the next character of a packed string
+
+[Args] :
+[in] LcdStrpackReader* a_reader_Ptr:
+a_reader_Ptr: pointer to the decoding state
+[Returns] : The character, or 0 at the end of the string (and on each call after it)
+--------------------------------------------------------------------------------------------------------------- */
+EXTERN uint8 LCD_strpackNext(LcdStrpackReader* a_reader_Ptr);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_strpackDisplayInst
+[Description] :	This function is responsible for displaying a packed string at the cursor, each character is given
+				to LCD_displayCharacterInst as soon as it is decoded
+
+[Args] :
+[in] Lcd* a_lcd_Ptr, const LcdStrpack* a_table_Ptr, uint16 a_index:
+a_lcd_Ptr: pointer to the display handle
+a_table_Ptr: the packed string table of the language
+a_index: index of the string
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+EXTERN void LCD_strpackDisplayInst(Lcd* a_lcd_Ptr, const LcdStrpack* a_table_Ptr, uint16 a_index);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_strpackDisplayRowColumnInst
+[Description] :	This function is responsible for displaying a packed string at a position
+
+[Args] :
+[in] Lcd* a_lcd_Ptr, uint8 a_row, uint8 a_col, const LcdStrpack* a_table_Ptr, uint16 a_index:
+a_lcd_Ptr: pointer to the display handle
+a_row, a_col: position of the first character
+a_table_Ptr: the packed string table of the language
+a_index: index of the string
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+EXTERN void LCD_strpackDisplayRowColumnInst(Lcd* a_lcd_Ptr, uint8 a_row, uint8 a_col, const LcdStrpack* a_table_Ptr,
+											uint16 a_index);
+
+/*	the same functions on the default display g_lcd */
+#define LCD_strpackDisplay(a_table_Ptr, a_index)	LCD_strpackDisplayInst(&g_lcd, (a_table_Ptr), (a_index))
+#define LCD_strpackDisplayRowColumn(a_row, a_col, a_table_Ptr, a_index)	\
+	LCD_strpackDisplayRowColumnInst(&g_lcd, (a_row), (a_col), (a_table_Ptr), (a_index))
+
+#endif /* LCD_STRPACK_H_ */
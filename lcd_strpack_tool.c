@@ -0,0 +1,532 @@
+/* --------------------------------------------------------------------------------------------------
+[FILE NAME]:		<lcd_strpack_tool.c>
+[AUTHOR(S)]:		<Ayman Younis>
+[DATE CREATED]:		<18/10/2026>
+[DESCRIPTION]:		This file contains the source main functions of the string table packer, it is built for the PC
+*					and generates the packed string tables of lcd_strpack.h at build time:
+*
+*					gcc -DHOST_EMULATION -o lcd_strpack_tool lcd_strpack_tool.c
+*					./lcd_strpack_tool <name> <language file> [language file ..]
+*
+*					Each language file holds one string per line: its identifier, one space or tab, then the
+*					text up to the end of the line (the spaces are kept), \\ is a backslash and \xHH the character
+*					HH (a ROM character or a custom character 0x08 to 0x0F). Empty lines and lines starting with
+*					# are skipped. All the files must have the same identifiers in the same order.
+*
+*					The strings of all the languages are compressed with one byte pair encoding dictionary, and
+*					<name>.h (the <NAME>_<ID> indexes, <NAME>_LANGUAGES) and <name>.c (the table g_<name> with
+*					one LcdStrpack per language, in the order of the files) are written in the current directory.
+-------------------------------------------------------------------------------------------------- */
+
+/*--------------------------------------------- INCLUDES ------------------------------------------*/
+#include "lcd_strpack.h"
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef HOST_EMULATION
+#error "lcd_strpack_tool.c is built for the PC only, define HOST_EMULATION"
+#endif
+
+/*---------------------------------- Definitions and configurations --------------------------------*/
+#define STRPACK_LANGUAGES		16
+#define STRPACK_STRINGS			1024
+#define STRPACK_ID_LENGTH		48
+#define STRPACK_LINE_LENGTH		512
+#define STRPACK_NAME_LENGTH		48
+
+/*	a pair is replaced by a token only if it saves more than the two bytes of the token in s_pairs_Ptr */
+#define STRPACK_MIN_COUNT		3
+
+/*	number of codes on a line of the generated tables */
+#define STRPACK_PER_LINE		16
+
+/*-------------------------------------- Structures and Unions ---------------------------------------*/
+/* ---------------------------------------------------------------------------------------------------
+[Structure Name]: StrpackString
+[Structure Description]: This structure is one string of one language:
+								1. s_codes_Ptr: its codes, characters then tokens as the pairs are replaced
+								2. s_length: number of codes
+---------------------------------------------------------------------------------------------------- */
+typedef struct
+{
+	uint8* s_codes_Ptr;
+	uint16 s_length;
+}StrpackString;
+
+/*-------------------------------------- Static FUNCTION DECLARATIONS --------------------------------------------*/
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : STRPACK_read
+[Description] :	This function is responsible for reading the strings of one language file
+
+[Args] :
+[in] const char* a_path_Ptr, uint8 a_language:
+a_path_Ptr: the language file
+a_language: index of the language, the identifiers of the first one are kept and the others are checked
+[Returns] : 1 if the file was read, 0 after printing the error
+--------------------------------------------------------------------------------------------------------------- */
+static uint8 STRPACK_read(const char* a_path_Ptr, uint8 a_language);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : STRPACK_pack
+[Description] :	This function is responsible for replacing the most frequent pair of codes by a free code, again
+				and again, until no pair saves flash, there is no free code left or the pairs would nest deeper
+				than LCD_STRPACK_DEPTH
+
+[Args] : This function takes no arguments
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+static void STRPACK_pack(void);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : STRPACK_writeHeader, STRPACK_writeSource
+[Description] :	These functions are responsible for generating <name>.h and <name>.c
+
+[Args] :
+[in] const char* a_name_Ptr, int a_argc, char* a_argv[]:
+a_name_Ptr: name of the table
+a_argc, a_argv: the language files, written in the comment of the generated file
+[Returns] : 1 if the file was written, 0 after printing the error
+--------------------------------------------------------------------------------------------------------------- */
+static uint8 STRPACK_writeHeader(const char* a_name_Ptr, int a_argc, char* a_argv[]);
+static uint8 STRPACK_writeSource(const char* a_name_Ptr, int a_argc, char* a_argv[]);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : STRPACK_writeBytes
+[Description] :	This function is responsible for writing the codes of a generated table, STRPACK_PER_LINE per line
+
+[Args] :
+[in] FILE* a_file_Ptr, const uint8* a_codes_Ptr, uint16 a_length, uint8 a_last:
+a_file_Ptr: the generated file
+a_codes_Ptr, a_length: the codes
+a_last: 1 if the codes end the table, no comma is written after the last one
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+static void STRPACK_writeBytes(FILE* a_file_Ptr, const uint8* a_codes_Ptr, uint16 a_length, uint8 a_last);
+
+/*------------------------------------------ Global Variables ------------------------------------------*/
+/* ---------------------------------------------------------------------------------------------------
+[Variable Name]: g_s_strings, g_s_ids, g_s_count, g_s_languages
+[Variable Description]: The strings of each language, their identifiers and their number
+---------------------------------------------------------------------------------------------------- */
+static StrpackString g_s_strings[STRPACK_LANGUAGES][STRPACK_STRINGS];
+static char g_s_ids[STRPACK_STRINGS][STRPACK_ID_LENGTH];
+static uint16 g_s_count;
+static uint8 g_s_languages;
+
+/* ---------------------------------------------------------------------------------------------------
+[Variable Name]: g_s_tokens, g_s_pairs, g_s_depth, g_s_used, g_s_pairCount, g_s_lastToken
+[Variable Description]: The dictionary: the pair of each token code (LCD_STRPACK_LITERAL for a character), the
+						two codes of each pair, the tokens nested in each code, the codes used by the strings, the
+						number of pairs and the highest token code
+---------------------------------------------------------------------------------------------------- */
+static uint8 g_s_tokens[256];
+static uint8 g_s_pairs[LCD_STRPACK_TOKENS * 2];
+static uint8 g_s_depth[256];
+static uint8 g_s_used[256];
+static uint16 g_s_pairCount;
+static uint8 g_s_lastToken;
+
+/* ---------------------------------------------------------------------------------------------------
+[Variable Name]: g_s_counts
+[Variable Description]: Number of times each pair of codes is found, indexed by the first then the second code
+---------------------------------------------------------------------------------------------------- */
+static uint32 g_s_counts[256][256];
+
+/*------------------------------------------ main function ----------------------------------------*/
+int main(int argc, char* argv[])
+{
+	uint32 raw = 0;
+	uint32 packed = 0;
+	uint16 loop;
+	uint8 language;
+
+	if ((argc < 3) || (argc - 2 > STRPACK_LANGUAGES) || (strlen(argv[1]) >= STRPACK_NAME_LENGTH))
+	{
+		fprintf(stderr, "usage: %s <name> <language file> [language file ..], up to %d languages\n",
+				argv[0], STRPACK_LANGUAGES);
+		return 1;
+	}
+
+	memset(g_s_tokens, LCD_STRPACK_LITERAL, sizeof(g_s_tokens));
+	for (language=0;language<argc - 2;language++)
+	{
+		if (STRPACK_read(argv[language + 2], language) == 0)
+		{
+			return 1;
+		}
+		g_s_languages++;
+	}
+	for (language=0;language<g_s_languages;language++)
+	{
+		for (loop=0;loop<g_s_count;loop++)
+		{
+			raw += g_s_strings[language][loop].s_length + 1;
+		}
+	}
+
+	STRPACK_pack();
+
+	if ((STRPACK_writeHeader(argv[1], argc - 2, &argv[2]) == 0) ||
+		(STRPACK_writeSource(argv[1], argc - 2, &argv[2]) == 0))
+	{
+		return 1;
+	}
+
+	/* the dictionary, then the offsets and the codes of each language */
+	packed = g_s_lastToken + 1 + g_s_pairCount * 2;
+	for (language=0;language<g_s_languages;language++)
+	{
+		packed += (g_s_count + 1) * sizeof(uint16);
+		for (loop=0;loop<g_s_count;loop++)
+		{
+			packed += g_s_strings[language][loop].s_length + 1;
+		}
+	}
+	printf("%s: %u strings, %u languages, %lu bytes packed to %lu bytes of flash with %u tokens\n", argv[1],
+		   (unsigned)g_s_count, (unsigned)g_s_languages, (unsigned long)raw, (unsigned long)packed,
+		   (unsigned)g_s_pairCount);
+	return 0;
+}
+
+/*------------------------------------------ STRPACK_read ------------------------------------------*/
+static uint8 STRPACK_read(const char* a_path_Ptr, uint8 a_language)
+{
+	FILE* file_Ptr = fopen(a_path_Ptr, "r");
+	char line[STRPACK_LINE_LENGTH];
+	uint8 text[STRPACK_LINE_LENGTH];
+	char* text_Ptr;
+	uint16 length;
+	uint16 count = 0;
+	uint16 number = 0;
+	unsigned int hex;
+	size_t idLength;
+
+	if (file_Ptr == NULL)
+	{
+		fprintf(stderr, "%s: cannot be opened\n", a_path_Ptr);
+		return 0;
+	}
+
+	while (fgets(line, sizeof(line), file_Ptr) != NULL)
+	{
+		number++;
+		line[strcspn(line, "\r\n")] = '\0';
+		if ((line[0] == '\0') || (line[0] == '#'))
+		{
+			continue;
+		}
+
+		idLength = strcspn(line, " \t");
+		if (idLength >= STRPACK_ID_LENGTH)
+		{
+			fprintf(stderr, "%s:%u: identifier longer than %d characters\n", a_path_Ptr, number,
+					STRPACK_ID_LENGTH - 1);
+			fclose(file_Ptr);
+			return 0;
+		}
+		if (count == STRPACK_STRINGS)
+		{
+			fprintf(stderr, "%s:%u: more than %d strings\n", a_path_Ptr, number, STRPACK_STRINGS);
+			fclose(file_Ptr);
+			return 0;
+		}
+		text_Ptr = &line[idLength];
+		if (*text_Ptr != '\0')
+		{
+			*text_Ptr++ = '\0';
+		}
+
+		if (a_language == 0)
+		{
+			strcpy(g_s_ids[count], line);
+		}
+		else if ((count >= g_s_count) || (strcmp(g_s_ids[count], line) != 0))
+		{
+			fprintf(stderr, "%s:%u: %s is not the identifier of the first language\n", a_path_Ptr, number, line);
+			fclose(file_Ptr);
+			return 0;
+		}
+
+		length = 0;
+		while (*text_Ptr != '\0')
+		{
+			if ((text_Ptr[0] == '\\') && (text_Ptr[1] == '\\'))
+			{
+				text[length] = '\\';
+				text_Ptr += 2;
+			}
+			else if ((text_Ptr[0] == '\\') && (text_Ptr[1] == 'x') && isxdigit((unsigned char)text_Ptr[2]) &&
+					 isxdigit((unsigned char)text_Ptr[3]))
+			{
+				sscanf(&text_Ptr[2], "%2x", &hex);
+				text[length] = (uint8)hex;
+				text_Ptr += 4;
+			}
+			else
+			{
+				text[length] = (uint8)*text_Ptr++;
+			}
+			/* 0 terminates the packed strings */
+			if (text[length] == '\0')
+			{
+				fprintf(stderr, "%s:%u: \\x00 is not allowed\n", a_path_Ptr, number);
+				fclose(file_Ptr);
+				return 0;
+			}
+			g_s_used[text[length]] = 1;
+			length++;
+		}
+
+		g_s_strings[a_language][count].s_codes_Ptr = malloc(length + 1);
+		memcpy(g_s_strings[a_language][count].s_codes_Ptr, text, length);
+		g_s_strings[a_language][count].s_length = length;
+		count++;
+	}
+	fclose(file_Ptr);
+
+	if ((a_language == 0) && (count == 0))
+	{
+		fprintf(stderr, "%s: no string\n", a_path_Ptr);
+		return 0;
+	}
+	if (a_language == 0)
+	{
+		g_s_count = count;
+	}
+	else if (count != g_s_count)
+	{
+		fprintf(stderr, "%s: %u strings instead of %u\n", a_path_Ptr, count, g_s_count);
+		return 0;
+	}
+	return 1;
+}
+
+/*------------------------------------------ STRPACK_pack ------------------------------------------*/
+static void STRPACK_pack(void)
+{
+	StrpackString* string_Ptr;
+	uint32 best;
+	uint16 token = 1;
+	uint16 first = 0;
+	uint16 second = 0;
+	uint16 a;
+	uint16 b;
+	uint16 loop;
+	uint16 in;
+	uint16 out;
+	uint8 language;
+	uint8 depth;
+
+	while (g_s_pairCount < LCD_STRPACK_TOKENS)
+	{
+		while ((token < 256) && (g_s_used[token] != 0))
+		{
+			token++;
+		}
+		if (token == 256)
+		{
+			return;
+		}
+
+		/* a run of the same code counts the pairs which can be replaced, not the overlapping ones */
+		memset(g_s_counts, 0, sizeof(g_s_counts));
+		for (language=0;language<g_s_languages;language++)
+		{
+			for (loop=0;loop<g_s_count;loop++)
+			{
+				string_Ptr = &g_s_strings[language][loop];
+				for (in=0;in + 1<string_Ptr->s_length;in++)
+				{
+					g_s_counts[string_Ptr->s_codes_Ptr[in]][string_Ptr->s_codes_Ptr[in + 1]]++;
+					if ((string_Ptr->s_codes_Ptr[in] == string_Ptr->s_codes_Ptr[in + 1]) &&
+						(in + 2 < string_Ptr->s_length) && (string_Ptr->s_codes_Ptr[in + 2] == string_Ptr->s_codes_Ptr[in]))
+					{
+						in++;
+					}
+				}
+			}
+		}
+
+		best = STRPACK_MIN_COUNT - 1;
+		for (a=1;a<256;a++)
+		{
+			for (b=1;b<256;b++)
+			{
+				depth = (g_s_depth[a] > g_s_depth[b]) ? g_s_depth[a] : g_s_depth[b];
+				if ((g_s_counts[a][b] > best) && (depth < LCD_STRPACK_DEPTH))
+				{
+					best	= g_s_counts[a][b];
+					first	= a;
+					second	= b;
+				}
+			}
+		}
+		if (best < STRPACK_MIN_COUNT)
+		{
+			return;
+		}
+
+		g_s_pairs[g_s_pairCount * 2]		= (uint8)first;
+		g_s_pairs[g_s_pairCount * 2 + 1]	= (uint8)second;
+		g_s_tokens[token]	= (uint8)g_s_pairCount;
+		g_s_depth[token]		= ((g_s_depth[first] > g_s_depth[second]) ? g_s_depth[first] : g_s_depth[second]) + 1;
+		g_s_used[token]		= 1;
+		g_s_lastToken		= (uint8)token;
+		g_s_pairCount++;
+
+		for (language=0;language<g_s_languages;language++)
+		{
+			for (loop=0;loop<g_s_count;loop++)
+			{
+				string_Ptr = &g_s_strings[language][loop];
+				for (in=0,out=0;in<string_Ptr->s_length;out++)
+				{
+					if ((in + 1 < string_Ptr->s_length) && (string_Ptr->s_codes_Ptr[in] == first) &&
+						(string_Ptr->s_codes_Ptr[in + 1] == second))
+					{
+						string_Ptr->s_codes_Ptr[out] = (uint8)token;
+						in += 2;
+					}
+					else
+					{
+						string_Ptr->s_codes_Ptr[out] = string_Ptr->s_codes_Ptr[in++];
+					}
+				}
+				string_Ptr->s_length = out;
+			}
+		}
+	}
+}
+
+/*--------------------------------------- STRPACK_writeHeader --------------------------------------*/
+static uint8 STRPACK_writeHeader(const char* a_name_Ptr, int a_argc, char* a_argv[])
+{
+	char path[STRPACK_NAME_LENGTH + 2];
+	char upper[STRPACK_NAME_LENGTH];
+	FILE* file_Ptr;
+	uint16 loop;
+
+	for (loop=0;a_name_Ptr[loop] != '\0';loop++)
+	{
+		upper[loop] = (char)toupper((unsigned char)a_name_Ptr[loop]);
+	}
+	upper[loop] = '\0';
+
+	sprintf(path, "%s.h", a_name_Ptr);
+	file_Ptr = fopen(path, "w");
+	if (file_Ptr == NULL)
+	{
+		fprintf(stderr, "%s: cannot be written\n", path);
+		return 0;
+	}
+
+	fprintf(file_Ptr, "/*\t%s, generated by lcd_strpack_tool.c from", path);
+	for (loop=0;loop<a_argc;loop++)
+	{
+		fprintf(file_Ptr, " %s", a_argv[loop]);
+	}
+	fprintf(file_Ptr, ", do not edit */\n\n#ifndef %s_H_\n#define %s_H_\n\n#include \"lcd_strpack.h\"\n\n", upper, upper);
+	fprintf(file_Ptr, "#define %s_LANGUAGES\t%u\n#define %s_COUNT\t%u\n\n", upper, (unsigned)g_s_languages,
+			upper, (unsigned)g_s_count);
+	for (loop=0;loop<g_s_count;loop++)
+	{
+		fprintf(file_Ptr, "#define %s_%s\t%u\n", upper, g_s_ids[loop], (unsigned)loop);
+	}
+	fprintf(file_Ptr, "\nextern const LcdStrpack g_%s[%s_LANGUAGES];\n\n#endif /* %s_H_ */\n", a_name_Ptr, upper,
+			upper);
+	fclose(file_Ptr);
+	return 1;
+}
+
+/*--------------------------------------- STRPACK_writeSource --------------------------------------*/
+static uint8 STRPACK_writeSource(const char* a_name_Ptr, int a_argc, char* a_argv[])
+{
+	char path[STRPACK_NAME_LENGTH + 2];
+	FILE* file_Ptr;
+	StrpackString* string_Ptr;
+	uint16 offset;
+	uint16 loop;
+	uint8 language;
+
+	sprintf(path, "%s.c", a_name_Ptr);
+	file_Ptr = fopen(path, "w");
+	if (file_Ptr == NULL)
+	{
+		fprintf(stderr, "%s: cannot be written\n", path);
+		return 0;
+	}
+
+	fprintf(file_Ptr, "/*\t%s, generated by lcd_strpack_tool.c from", path);
+	for (loop=0;loop<a_argc;loop++)
+	{
+		fprintf(file_Ptr, " %s", a_argv[loop]);
+	}
+	fprintf(file_Ptr, ", do not edit */\n\n#include \"%s.h\"\n\n", a_name_Ptr);
+
+	fprintf(file_Ptr, "static const uint8 g_s_%sTokens[%u] FLASH_CONST =\n{\n", a_name_Ptr,
+			(unsigned)(g_s_lastToken + 1));
+	STRPACK_writeBytes(file_Ptr, g_s_tokens, g_s_lastToken + 1, 1);
+	fprintf(file_Ptr, "};\n\nstatic const uint8 g_s_%sPairs[%u] FLASH_CONST =\n{\n", a_name_Ptr,
+			(unsigned)((g_s_pairCount != 0) ? g_s_pairCount * 2 : 1));
+	STRPACK_writeBytes(file_Ptr, g_s_pairs, (g_s_pairCount != 0) ? g_s_pairCount * 2 : 1, 1);
+	fprintf(file_Ptr, "};\n");
+
+	for (language=0;language<g_s_languages;language++)
+	{
+		fprintf(file_Ptr, "\n/*\t%s */\nstatic const uint16 g_s_%sOffsets%u[%u] FLASH_CONST =\n{\n", a_argv[language],
+				a_name_Ptr, (unsigned)language, (unsigned)(g_s_count + 1));
+		offset = 0;
+		for (loop=0;loop<=g_s_count;loop++)
+		{
+			fprintf(file_Ptr, "%s%u%s", ((loop % STRPACK_PER_LINE) == 0) ? "\t" : "", (unsigned)offset,
+					(loop == g_s_count) ? "\n" : (((loop % STRPACK_PER_LINE) == STRPACK_PER_LINE - 1) ? ",\n" : ", "));
+			if (loop < g_s_count)
+			{
+				offset += g_s_strings[language][loop].s_length + 1;
+			}
+		}
+		fprintf(file_Ptr, "};\n\nstatic const uint8 g_s_%sData%u[%u] FLASH_CONST =\n{\n", a_name_Ptr,
+				(unsigned)language, (unsigned)offset);
+		for (loop=0;loop<g_s_count;loop++)
+		{
+			string_Ptr = &g_s_strings[language][loop];
+			fprintf(file_Ptr, "\t/* %s */\n", g_s_ids[loop]);
+			string_Ptr->s_codes_Ptr[string_Ptr->s_length] = '\0';
+			STRPACK_writeBytes(file_Ptr, string_Ptr->s_codes_Ptr, string_Ptr->s_length + 1, (uint8)(loop == g_s_count - 1));
+		}
+		fprintf(file_Ptr, "};\n");
+	}
+
+	fprintf(file_Ptr, "\nconst LcdStrpack g_%s[%u] =\n{\n", a_name_Ptr, (unsigned)g_s_languages);
+	for (language=0;language<g_s_languages;language++)
+	{
+		fprintf(file_Ptr, "\t{g_s_%sTokens, g_s_%sPairs, g_s_%sOffsets%u, g_s_%sData%u, %u, %u}%s\n", a_name_Ptr,
+				a_name_Ptr, a_name_Ptr, (unsigned)language, a_name_Ptr, (unsigned)language, (unsigned)g_s_count,
+				(unsigned)g_s_lastToken, (language == g_s_languages - 1) ? "" : ",");
+	}
+	fprintf(file_Ptr, "};\n");
+	fclose(file_Ptr);
+	return 1;
+}
+
+/*--------------------------------------- STRPACK_writeBytes ---------------------------------------*/
+static void STRPACK_writeBytes(FILE* a_file_Ptr, const uint8* a_codes_Ptr, uint16 a_length, uint8 a_last)
+{
+	uint16 loop;
+
+	for (loop=0;loop<a_length;loop++)
+	{
+		fprintf(a_file_Ptr, "%s0x%02X%s", ((loop % STRPACK_PER_LINE) == 0) ? "\t" : "", a_codes_Ptr[loop],
+				((loop == a_length - 1) && (a_last != 0)) ? "" : ",");
+		if ((loop == a_length - 1) || ((loop % STRPACK_PER_LINE) == STRPACK_PER_LINE - 1))
+		{
+			fprintf(a_file_Ptr, "\n");
+		}
+		else
+		{
+			fprintf(a_file_Ptr, " ");
+		}
+	}
+}
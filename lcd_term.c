@@ -0,0 +1,301 @@
+/* --------------------------------------------------------------------------------------------------
+[FILE NAME]:		<lcd_term.c>
+[AUTHOR(S)]:		<Ayman Younis>
+[DATE CREATED]:		<18/10/2026>
+[DESCRIPTION]:		This file contains the lcd terminal source file, a stdio stream writing to the display with
+*					line wrap and scrolling from a RAM copy of the text.
+[USAGE]:			<See the C include lcd_term.h file for a description of each function>
+-------------------------------------------------------------------------------------------------- */
+
+/*--------------------------------------------- INCLUDES ------------------------------------------*/
+/*	fopencookie of the glibc */
+#ifdef HOST_EMULATION
+#define _GNU_SOURCE
+#endif
+
+#define LCD_TERM_H_MAIN
+#include "lcd_term.h"
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_termLineFeed
+[Description] :	This function is responsible for moving to the next row, on the last row the scroll waits for the
+				next character
+
+[Args] :
+[in] LcdTerm* a_term_Ptr:
+a_term_Ptr: pointer to the terminal
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+static void LCD_termLineFeed(LcdTerm* a_term_Ptr);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_termScroll
+[Description] :	This function is responsible for moving the text up by one row and blanking the last row, each row
+				is given its new text with LCD_termRow in one batch
+
+[Args] :
+[in] LcdTerm* a_term_Ptr:
+a_term_Ptr: pointer to the terminal
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+static void LCD_termScroll(LcdTerm* a_term_Ptr);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_termRow
+[Description] :	This function is responsible for giving a row a new text, only the cells from the first to the last
+				one which differ are written
+
+[Args] :
+[in] LcdTerm* a_term_Ptr, uint8 a_row, const uint8* a_text_Ptr:
+a_term_Ptr: pointer to the terminal
+a_row: the row
+a_text_Ptr: its new text, or 0 for a blank row
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+static void LCD_termRow(LcdTerm* a_term_Ptr, uint8 a_row, const uint8* a_text_Ptr);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_termCell
+[Description] :	This function is responsible for writing one cell, the cursor location is sent only if the address
+				counter of the display isn't on the cell
+
+[Args] :
+[in] LcdTerm* a_term_Ptr, uint8 a_row, uint8 a_col, uint8 a_character:
+a_term_Ptr: pointer to the terminal
+a_row, a_col: the cell
+a_character: its character
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+static void LCD_termCell(LcdTerm* a_term_Ptr, uint8 a_row, uint8 a_col, uint8 a_character);
+
+#ifdef HOST_EMULATION
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_termStreamWrite
+[Description] :	This function is responsible for writing the characters given by the stdio stream of the host, they
+				are sent in one batch
+
+[Args] :
+[in] void* a_cookie_Ptr, const char* a_buffer_Ptr, size_t a_size:
+a_cookie_Ptr: the terminal
+a_buffer_Ptr, a_size: the characters
+[Returns] : The number of characters written
+--------------------------------------------------------------------------------------------------------------- */
+static ssize_t LCD_termStreamWrite(void* a_cookie_Ptr, const char* a_buffer_Ptr, size_t a_size);
+#else
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_termStreamPut
+[Description] :	This function is responsible for writing one character given by the avr-libc stream
+
+[Args] :
+[in] char a_character, FILE* a_stream_Ptr:
+a_character: the character
+a_stream_Ptr: the stream, its user data is the terminal
+[Returns] : 0
+--------------------------------------------------------------------------------------------------------------- */
+static int LCD_termStreamPut(char a_character, FILE* a_stream_Ptr);
+#endif
+
+/*------------------------------------- FUNCTION Definitions --------------------------------------*/
+/*----------------------------------------- LCD_termOpen -------------------------------------------*/
+FILE* LCD_termOpen(LcdTerm* a_term_Ptr, Lcd* a_lcd_Ptr)
+{
+#ifdef HOST_EMULATION
+	cookie_io_functions_t functions = {0, LCD_termStreamWrite, 0, 0};
+#endif
+
+	a_term_Ptr->s_lcd_Ptr = a_lcd_Ptr;
+	LCD_termClear(a_term_Ptr);
+
+#ifdef HOST_EMULATION
+	a_term_Ptr->s_stream_Ptr = fopencookie(a_term_Ptr, "w", functions);
+	if (a_term_Ptr->s_stream_Ptr != 0)
+	{
+		setvbuf(a_term_Ptr->s_stream_Ptr, 0, _IONBF, 0);
+	}
+#else
+	fdev_setup_stream(&a_term_Ptr->s_stream, LCD_termStreamPut, 0, _FDEV_SETUP_WRITE);
+	fdev_set_udata(&a_term_Ptr->s_stream, a_term_Ptr);
+	a_term_Ptr->s_stream_Ptr = &a_term_Ptr->s_stream;
+#endif
+	return a_term_Ptr->s_stream_Ptr;
+}
+
+/*----------------------------------------- LCD_termPutc -------------------------------------------*/
+void LCD_termPutc(LcdTerm* a_term_Ptr, uint8 a_character)
+{
+	switch (a_character)
+	{
+		case '\n':
+			a_term_Ptr->s_col = 0;
+			LCD_termLineFeed(a_term_Ptr);
+			break;
+		case '\r':
+			a_term_Ptr->s_col = 0;
+			break;
+		case '\b':
+			if (a_term_Ptr->s_col != 0)
+			{
+				a_term_Ptr->s_col--;
+			}
+			break;
+		case '\f':
+			LCD_termClear(a_term_Ptr);
+			break;
+		default:
+			if ((a_character == '\0') || ((a_character >= LCD_GLYPHS) && (a_character < ' ')))
+			{
+				break;
+			}
+			if (a_term_Ptr->s_col == a_term_Ptr->s_lcd_Ptr->s_length)
+			{
+				a_term_Ptr->s_col = 0;
+				LCD_termLineFeed(a_term_Ptr);
+			}
+			if (a_term_Ptr->s_scroll != 0)
+			{
+				a_term_Ptr->s_scroll = 0;
+				LCD_termScroll(a_term_Ptr);
+			}
+			LCD_termCell(a_term_Ptr, a_term_Ptr->s_row, a_term_Ptr->s_col, a_character);
+			a_term_Ptr->s_col++;
+			break;
+	}
+}
+
+/*----------------------------------------- LCD_termClear ------------------------------------------*/
+void LCD_termClear(LcdTerm* a_term_Ptr)
+{
+	uint8 row;
+	uint8 col;
+
+	for (row=0;row<LCD_MAX_LINES;row++)
+	{
+		for (col=0;col<LCD_MAX_LENGTH;col++)
+		{
+			a_term_Ptr->s_text[row][col] = ' ';
+		}
+	}
+	a_term_Ptr->s_row		= 0;
+	a_term_Ptr->s_col		= 0;
+	a_term_Ptr->s_scroll	= 0;
+	/* the next cell is addressed again, the clear doesn't select the controller of the first row */
+	a_term_Ptr->s_drawRow	= LCD_TERM_NOWHERE;
+	LCD_clearScreenInst(a_term_Ptr->s_lcd_Ptr);
+}
+
+/*---------------------------------------- LCD_termLineFeed ----------------------------------------*/
+static void LCD_termLineFeed(LcdTerm* a_term_Ptr)
+{
+	if (a_term_Ptr->s_scroll != 0)
+	{
+		/* a blank line was fed already */
+		LCD_termScroll(a_term_Ptr);
+	}
+	else if (a_term_Ptr->s_row + 1 < a_term_Ptr->s_lcd_Ptr->s_lines)
+	{
+		a_term_Ptr->s_row++;
+	}
+	else
+	{
+		a_term_Ptr->s_scroll = 1;
+	}
+}
+
+/*----------------------------------------- LCD_termScroll -----------------------------------------*/
+static void LCD_termScroll(LcdTerm* a_term_Ptr)
+{
+	uint8 last = a_term_Ptr->s_lcd_Ptr->s_lines - 1;
+	uint8 row;
+
+	LCD_beginBatch();
+	/* a row takes the old text of the next one before it is changed */
+	for (row=0;row<last;row++)
+	{
+		LCD_termRow(a_term_Ptr, row, a_term_Ptr->s_text[row + 1]);
+	}
+	LCD_termRow(a_term_Ptr, last, 0);
+	LCD_endBatch();
+}
+
+/*------------------------------------------ LCD_termRow -------------------------------------------*/
+static void LCD_termRow(LcdTerm* a_term_Ptr, uint8 a_row, const uint8* a_text_Ptr)
+{
+	uint8* text_Ptr = a_term_Ptr->s_text[a_row];
+	uint8 length = a_term_Ptr->s_lcd_Ptr->s_length;
+	uint8 first;
+	uint8 last;
+	uint8 col;
+
+	for (first=0;first<length;first++)
+	{
+		if (text_Ptr[first] != ((a_text_Ptr != 0) ? a_text_Ptr[first] : ' '))
+		{
+			break;
+		}
+	}
+	if (first == length)
+	{
+		return;
+	}
+	for (last=length - 1;last>first;last--)
+	{
+		if (text_Ptr[last] != ((a_text_Ptr != 0) ? a_text_Ptr[last] : ' '))
+		{
+			break;
+		}
+	}
+
+	/* the unchanged cells inside the span are written again, it costs less than a cursor location each */
+	if ((a_term_Ptr->s_drawRow != a_row) || (a_term_Ptr->s_drawCol != first))
+	{
+		LCD_goToRowColumnInst(a_term_Ptr->s_lcd_Ptr, a_row, first);
+	}
+	for (col=first;col<=last;col++)
+	{
+		text_Ptr[col] = (a_text_Ptr != 0) ? a_text_Ptr[col] : ' ';
+		LCD_displayCharacterInst(a_term_Ptr->s_lcd_Ptr, text_Ptr[col]);
+	}
+	a_term_Ptr->s_drawRow = a_row;
+	a_term_Ptr->s_drawCol = last + 1;
+}
+
+/*------------------------------------------ LCD_termCell ------------------------------------------*/
+static void LCD_termCell(LcdTerm* a_term_Ptr, uint8 a_row, uint8 a_col, uint8 a_character)
+{
+	if (a_term_Ptr->s_text[a_row][a_col] == a_character)
+	{
+		return;
+	}
+	a_term_Ptr->s_text[a_row][a_col] = a_character;
+
+	if ((a_term_Ptr->s_drawRow != a_row) || (a_term_Ptr->s_drawCol != a_col))
+	{
+		LCD_goToRowColumnInst(a_term_Ptr->s_lcd_Ptr, a_row, a_col);
+	}
+	LCD_displayCharacterInst(a_term_Ptr->s_lcd_Ptr, a_character);
+	a_term_Ptr->s_drawRow = a_row;
+	a_term_Ptr->s_drawCol = a_col + 1;
+}
+
+#ifdef HOST_EMULATION
+/*-------------------------------------- LCD_termStreamWrite ---------------------------------------*/
+static ssize_t LCD_termStreamWrite(void* a_cookie_Ptr, const char* a_buffer_Ptr, size_t a_size)
+{
+	size_t loop;
+
+	LCD_beginBatch();
+	for (loop=0;loop<a_size;loop++)
+	{
+		LCD_termPutc((LcdTerm*)a_cookie_Ptr, (uint8)a_buffer_Ptr[loop]);
+	}
+	LCD_endBatch();
+	return (ssize_t)a_size;
+}
+#else
+/*--------------------------------------- LCD_termStreamPut ----------------------------------------*/
+static int LCD_termStreamPut(char a_character, FILE* a_stream_Ptr)
+{
+	LCD_termPutc((LcdTerm*)fdev_get_udata(a_stream_Ptr), (uint8)a_character);
+	return 0;
+}
+#endif
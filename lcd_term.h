@@ -0,0 +1,110 @@
+/* --------------------------------------------------------------------------------------------------
+[FILE NAME]:		<lcd_term.h>
+[AUTHOR(S)]:		<Ayman Younis>
+[DATE CREATED]:		<18/10/2026>
+[DESCRIPTION]:		This file contains the lcd terminal header file, the display becomes a stdio stream (printf,
+*					fputs, ..) with the behaviour of a small terminal, for a debug log console for example.
+*
+*					The characters are written from the top left cell and wrap to the next row in the visual order
+*					of the rows, whatever the DDRAM addresses of the controller. '\n' goes to the start of the next
+*					row, '\r' to the start of the row, '\b' one column back and '\f' clears the display. The codes
+*					1 to 7 show the custom characters, the other control codes are ignored.
+*
+*					A line feed on the last row scrolls the text up by one row, when the next character comes so a
+*					log line ending with '\n' stays on the bottom row. The terminal keeps a RAM copy of the text
+*					and a scroll writes in each row only the span of cells whose new text differs from the old one,
+*					in one batch, instead of a clear and a repaint of the whole display. A character equal to the
+*					one already in its cell isn't written either.
+*
+*					The terminal owns the display: the cursor location is only sent when the next cell isn't the
+*					one after the last written cell, other writes to the display meanwhile are not seen.
+*					With avr-libc the stream is set up with fdev_setup_stream, stdout = LCD_termOpen(..) makes
+*					printf write to the display. With HOST_EMULATION it is opened with the glibc fopencookie.
+-------------------------------------------------------------------------------------------------- */
+
+/*	LCD_TERM_H_MAIN will be defined at the lcd terminal source file only, so the EXTERN will be removed, also
+*   EXTERN becomes extern in other files that include lcd_term.h
+*/
+#ifdef LCD_TERM_H_MAIN
+#define EXTERN
+#else
+#define EXTERN extern
+#endif
+
+#ifndef LCD_TERM_H_
+#define LCD_TERM_H_
+
+/*--------------------------------------------- INCLUDES -------------------------------------------*/
+#include "lcd.h"
+#include <stdio.h>
+
+/*---------------------------------- Definitions and configurations --------------------------------*/
+/*	s_drawRow of an unknown address counter */
+#define LCD_TERM_NOWHERE		0xFF
+
+/*-------------------------------------- Structures and Unions ---------------------------------------*/
+/* ---------------------------------------------------------------------------------------------------
+[Structure Name]: LcdTerm
+[Structure Description]: This structure is the terminal of one display:
+									1. s_lcd_Ptr: the display, it must be initialized before LCD_termOpen
+									2. s_text: the text on the display
+									3. s_row, s_col: the cell of the next character, s_col is the length of the line
+									   when the row is full and the next character wraps
+									4. s_scroll: 1 if a line feed on the last row is waiting for the next character
+									5. s_drawRow, s_drawCol: the cell the address counter of the display points to,
+									   s_drawRow is LCD_TERM_NOWHERE if it is unknown
+									6. s_stream_Ptr: the stdio stream, s_stream holds it with avr-libc
+---------------------------------------------------------------------------------------------------- */
+typedef struct
+{
+	Lcd* s_lcd_Ptr;
+	uint8 s_text[LCD_MAX_LINES][LCD_MAX_LENGTH];
+	uint8 s_row;
+	uint8 s_col;
+	uint8 s_scroll;
+	uint8 s_drawRow;
+	uint8 s_drawCol;
+	FILE* s_stream_Ptr;
+#ifndef HOST_EMULATION
+	FILE s_stream;
+#endif
+}LcdTerm;
+
+/*----------------------------------- FUNCTION DECLARATIONS ----------------------------------------------------*/
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_termOpen
+[Description] :	This function is responsible for clearing the display and opening its terminal stream, the stream is
+				not buffered
+
+[Args] :
+[in] LcdTerm* a_term_Ptr, Lcd* a_lcd_Ptr:
+a_term_Ptr: pointer to the terminal, it must stay valid while the stream is used
+a_lcd_Ptr: pointer to the display handle
+[Returns] : The stream, or 0 if the host couldn't open it
+--------------------------------------------------------------------------------------------------------------- */
+EXTERN FILE* LCD_termOpen(LcdTerm* a_term_Ptr, Lcd* a_lcd_Ptr);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_termPutc
+[Description] :	This function is responsible for writing one character to the terminal, as the stream does
+
+[Args] :
+[in] LcdTerm* a_term_Ptr, uint8 a_character:
+a_term_Ptr: pointer to the terminal
+a_character: the character or control code
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+EXTERN void LCD_termPutc(LcdTerm* a_term_Ptr, uint8 a_character);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_termClear
+[Description] :	This function is responsible for clearing the terminal, the next character goes to the top left cell
+
+[Args] :
+[in] LcdTerm* a_term_Ptr:
+a_term_Ptr: pointer to the terminal
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+EXTERN void LCD_termClear(LcdTerm* a_term_Ptr);
+
+#endif /* LCD_TERM_H_ */
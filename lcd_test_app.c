@@ -9,29 +9,41 @@
 /*--------------------------------------------- INCLUDES ------------------------------------------*/
 #include "lcd.h"
 
+/*------------------------------------------ Global Variables ------------------------------------------*/
+/* ---------------------------------------------------------------------------------------------------
+[Variable Name]: g_frame
+[Variable Description]: The frame buffer each screen is composed in before it is written to the display
+---------------------------------------------------------------------------------------------------- */
+static LcdFrame g_frame;
+
 /*------------------------------------------ main function ----------------------------------------*/
 int main(void)
 {
 	int i;
 	
+	LCD_attachFrame(&g_frame);
     LCD_init(LCD_CURSOR_OFF);
 	
 	while(1)
     {
+		LCD_beginFrame();
+		LCD_clearScreen();
 		LCD_displayStringRowColumn(0,4,"Hello World!");
 		LCD_goToRowColumn(1,1);
 		LCD_displayString("TESTING LCD DRIVER");
+		LCD_commitFrame();
 		_delay_ms(1500);
-		LCD_clearScreen();
 		
+		/* each position is drawn off-screen, only the changed cells are written without clearing */
 		for (i=20;i>=0;i--)
 		{
+			LCD_beginFrame();
 			LCD_clearScreen();
 			LCD_displayStringRowColumn(0,i+1,"EmbeddedC_Project2");
 			LCD_displayStringRowColumn(1,i,"Ayman_ITI  18/1/2015");
+			LCD_commitFrame();
 			_delay_ms(150);
 		}
 		_delay_ms(1500);
-		LCD_clearScreen();
 	}
 }
\ No newline at end of file
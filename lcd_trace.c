@@ -0,0 +1,531 @@
+/* --------------------------------------------------------------------------------------------------
+[FILE NAME]:		<lcd_trace.c>
+[AUTHOR(S)]:		<Ayman Younis>
+[DATE CREATED]:		<18/10/2026>
+[DESCRIPTION]:		This file contains the lcd waveform tracer source file, it samples the lines of the traced
+*					display after each DIO access of the host emulation, writes their transitions to a VCD file
+*					and checks them against the datasheet timings.
+[USAGE]:			<See the C include lcd_trace.h file for a description of each function>
+-------------------------------------------------------------------------------------------------- */
+
+/*--------------------------------------------- INCLUDES ------------------------------------------*/
+#define LCD_TRACE_H_MAIN
+#include "lcd_trace.h"
+#include <stdio.h>
+
+#ifndef HOST_EMULATION
+#error "lcd_trace.c is built with the host emulation only, define HOST_EMULATION"
+#endif
+
+/*-------------------------------------- Structures and Unions ---------------------------------------*/
+/* ---------------------------------------------------------------------------------------------------
+[Structure Name]: LcdTraceCtrl
+[Structure Description]: This structure is the traced state of one controller:
+								1. s_en: last level of its enable pin
+								2. s_rise: time of the last enable rising edge
+								3. s_written, s_busyUntil: write time and end of the execution time of the last
+								   instruction
+								4. s_mode8: 1 while the controller is in 8-bit interface mode, as after power-on
+								5. s_phase, s_high: nibble count and high nibble of a byte in 4-bit mode
+								6. s_resets: function sets of the power-on reset sequence received
+---------------------------------------------------------------------------------------------------- */
+typedef struct
+{
+	uint8 s_en;
+	HostTime s_rise;
+	HostTime s_written;
+	HostTime s_busyUntil;
+	uint8 s_mode8;
+	uint8 s_phase;
+	uint8 s_high;
+	uint8 s_resets;
+}LcdTraceCtrl;
+
+/*------------------------------------------ Global Variables ------------------------------------------*/
+/* ---------------------------------------------------------------------------------------------------
+[Variable Name]: g_s_traceFile, g_s_traceLcd
+[Variable Description]: The VCD file and the traced display, the file is 0 when nothing is traced
+---------------------------------------------------------------------------------------------------- */
+static FILE* g_s_traceFile;
+static const Lcd* g_s_traceLcd;
+
+/* ---------------------------------------------------------------------------------------------------
+[Variable Name]: g_s_traceRs, g_s_traceRw, g_s_traceData, g_s_traceSetup, g_s_traceDataSetup, g_s_traceFall
+[Variable Description]: The last levels of the lines shared by the controllers, the time of the last RS or RW
+						change which starts the address setup time, the time of the last data change which starts
+						the data setup time, and the time of the last write enable falling edge which starts the
+						hold time (0 before the first one)
+---------------------------------------------------------------------------------------------------- */
+static uint8 g_s_traceRs;
+static uint8 g_s_traceRw;
+static uint8 g_s_traceData;
+static HostTime g_s_traceSetup;
+static HostTime g_s_traceDataSetup;
+static HostTime g_s_traceFall;
+
+/* ---------------------------------------------------------------------------------------------------
+[Variable Name]: g_s_traceCtrl, g_s_traceTime, g_s_traceViolations
+[Variable Description]: The traced state of each controller, the last time written to the file and the number of
+						violations found
+---------------------------------------------------------------------------------------------------- */
+static LcdTraceCtrl g_s_traceCtrl[LCD_MAX_CONTROLLERS];
+static HostTime g_s_traceTime;
+static uint16 g_s_traceViolations;
+
+/*-------------------------------------- Static FUNCTION DECLARATIONS --------------------------------------------*/
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_traceSample
+[Description] :	This function is responsible for reading the lines of the traced display after a DIO access,
+				writing the changed ones and checking the timings of the enable edges
+
+[Args] : This function takes no arguments
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+static void LCD_traceSample(void);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_traceLevel
+[Description] :	This function is responsible for returning the level of one pin of the traced display
+
+[Args] :
+[in] const DioConfig* a_pin_Ptr:
+a_pin_Ptr: the pin
+[Returns] : LOGIC_HIGH or LOGIC_LOW
+--------------------------------------------------------------------------------------------------------------- */
+static uint8 LCD_traceLevel(const DioConfig* a_pin_Ptr);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_traceFalling
+[Description] :	This function is responsible for following the instruction written by an enable falling edge, the
+				byte is complete after two nibbles in 4-bit mode, its execution time starts then
+
+[Args] :
+[in] uint8 a_ctrl, HostTime a_now:
+a_ctrl: index of the controller
+a_now: time of the edge
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+static void LCD_traceFalling(uint8 a_ctrl, HostTime a_now);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_traceViolation
+[Description] :	This function is responsible for counting and printing one timing violation
+
+[Args] :
+[in] uint8 a_ctrl, const char* a_msg_Ptr, HostTime a_ns, uint32 a_limitNs:
+a_ctrl: index of the controller
+a_msg_Ptr: the violated timing
+a_ns: the measured time
+a_limitNs: the datasheet minimum
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+static void LCD_traceViolation(uint8 a_ctrl, const char* a_msg_Ptr, HostTime a_ns, uint32 a_limitNs);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_traceBits
+[Description] :	This function is responsible for writing the value of a vector signal
+
+[Args] :
+[in] uint16 a_value, uint8 a_width, char a_id:
+a_value: the value
+a_width: number of bits of the signal
+a_id: VCD identifier of the signal
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+static void LCD_traceBits(uint16 a_value, uint8 a_width, char a_id);
+
+/*------------------------------------- FUNCTION Definitions --------------------------------------*/
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_traceOpenInst
+[Description] :	This function is responsible for starting the trace of a display, it writes the VCD header with one
+				signal for RS, RW, each enable pin, the data lines and the violations count, and registers the
+				sampling function as an observer of the host emulation
+
+[Args] :
+[in] const Lcd* a_lcd_Ptr, const char* a_path_Ptr:
+a_lcd_Ptr: pointer to the display handle
+a_path_Ptr: path of the VCD file to be written
+[Returns] : 1 if the trace is started or 0 if the file can't be created
+--------------------------------------------------------------------------------------------------------------- */
+uint8 LCD_traceOpenInst(const Lcd* a_lcd_Ptr, const char* a_path_Ptr)
+{
+	static uint8 s_observing;
+	uint8 ctrl;
+	uint8 loop;
+
+	LCD_traceClose();
+	g_s_traceFile = fopen(a_path_Ptr, "w");
+	if (g_s_traceFile == 0)
+	{
+		return 0;
+	}
+	g_s_traceLcd = a_lcd_Ptr;
+	g_s_traceViolations = 0;
+	g_s_traceTime = HOST_timeNs();
+	g_s_traceSetup = g_s_traceTime;
+	g_s_traceDataSetup = g_s_traceTime;
+	g_s_traceFall = 0;
+	g_s_traceRs = LCD_traceLevel(&a_lcd_Ptr->s_rs);
+	g_s_traceRw = LCD_traceLevel(&a_lcd_Ptr->s_rw);
+	g_s_traceData = 0;
+	for (loop=0;loop<LCD_IO_MODE;loop++)
+	{
+		g_s_traceData |= LCD_traceLevel(&a_lcd_Ptr->s_data[loop]) << loop;
+	}
+
+	/* identifiers: ! RS, " RW, # data, $ violations, % and up the enable pins */
+	fprintf(g_s_traceFile, "$version AVR_LCD_Libraries lcd_trace $end\n$timescale 1ns $end\n$scope module lcd $end\n");
+	fprintf(g_s_traceFile, "$var wire 1 ! rs $end\n$var wire 1 \" rw $end\n");
+	fprintf(g_s_traceFile, "$var wire %u # data $end\n$var wire 16 $ violations $end\n", LCD_IO_MODE);
+	for (ctrl=0;ctrl<a_lcd_Ptr->s_controllers;ctrl++)
+	{
+		fprintf(g_s_traceFile, "$var wire 1 %c en%u $end\n", '%' + ctrl, ctrl);
+	}
+	fprintf(g_s_traceFile, "$upscope $end\n$enddefinitions $end\n#%llu\n$dumpvars\n", g_s_traceTime);
+	fprintf(g_s_traceFile, "%u!\n%u\"\n", g_s_traceRs, g_s_traceRw);
+	LCD_traceBits(g_s_traceData, LCD_IO_MODE, '#');
+	LCD_traceBits(0, 16, '$');
+	for (ctrl=0;ctrl<a_lcd_Ptr->s_controllers;ctrl++)
+	{
+		/* the controllers are traced from their power-on state: 8-bit mode, not busy */
+		g_s_traceCtrl[ctrl].s_en = LCD_traceLevel(&a_lcd_Ptr->s_ctrl[ctrl].s_en);
+		g_s_traceCtrl[ctrl].s_rise = 0;
+		g_s_traceCtrl[ctrl].s_written = 0;
+		g_s_traceCtrl[ctrl].s_busyUntil = 0;
+		g_s_traceCtrl[ctrl].s_mode8 = 1;
+		g_s_traceCtrl[ctrl].s_phase = 0;
+		g_s_traceCtrl[ctrl].s_resets = 0;
+		fprintf(g_s_traceFile, "%u%c\n", g_s_traceCtrl[ctrl].s_en, '%' + ctrl);
+	}
+	fprintf(g_s_traceFile, "$end\n");
+
+	if (s_observing == 0)
+	{
+		s_observing = HOST_addObserver(LCD_traceSample);
+	}
+	return s_observing;
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_traceClose
+[Description] :	This function is responsible for ending the trace at the current simulated time and closing the file
+
+[Args] : This function takes no arguments
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+void LCD_traceClose(void)
+{
+	if (g_s_traceFile != 0)
+	{
+		fprintf(g_s_traceFile, "#%llu\n", HOST_timeNs());
+		fclose(g_s_traceFile);
+		g_s_traceFile = 0;
+	}
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_traceViolations
+[Description] :	This function is responsible for returning the number of timing violations found since
+				LCD_traceOpenInst
+
+[Args] : This function takes no arguments
+[Returns] : The number of timing violations, it stops at 65535
+--------------------------------------------------------------------------------------------------------------- */
+uint16 LCD_traceViolations(void)
+{
+	return g_s_traceViolations;
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_traceSample
+[Description] :	This function is responsible for reading the lines of the traced display after a DIO access,
+				writing the changed ones and checking the timings of the enable edges
+
+[Args] : This function takes no arguments
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+static void LCD_traceSample(void)
+{
+	HostTime now = HOST_timeNs();
+	LcdTraceCtrl* ctrl_Ptr;
+	uint8 anyEnHigh = 0;
+	uint8 level;
+	uint8 data = 0;
+	uint8 ctrl;
+	uint8 loop;
+
+	if (g_s_traceFile == 0)
+	{
+		return;
+	}
+	for (ctrl=0;ctrl<g_s_traceLcd->s_controllers;ctrl++)
+	{
+		anyEnHigh |= g_s_traceCtrl[ctrl].s_en;
+	}
+	for (loop=0;loop<LCD_IO_MODE;loop++)
+	{
+		data |= LCD_traceLevel(&g_s_traceLcd->s_data[loop]) << loop;
+	}
+
+	/* RS and RW are latched on the enable rising edge and must not change while it is high */
+	level = LCD_traceLevel(&g_s_traceLcd->s_rs);
+	if (level != g_s_traceRs)
+	{
+		fprintf(g_s_traceFile, "#%llu\n%u!\n", now, level);
+		g_s_traceTime = now;
+		g_s_traceRs = level;
+		g_s_traceSetup = now;
+		if (anyEnHigh)
+		{
+			LCD_traceViolation(0, "RS changed while EN high", 0, 0);
+		}
+		else if ((g_s_traceFall != 0) && ((now - g_s_traceFall) < LCD_T_HOLD_NS))
+		{
+			LCD_traceViolation(0, "RS hold (tAH)", now - g_s_traceFall, LCD_T_HOLD_NS);
+		}
+	}
+	level = LCD_traceLevel(&g_s_traceLcd->s_rw);
+	if (level != g_s_traceRw)
+	{
+		if (now != g_s_traceTime)
+		{
+			fprintf(g_s_traceFile, "#%llu\n", now);
+			g_s_traceTime = now;
+		}
+		fprintf(g_s_traceFile, "%u\"\n", level);
+		g_s_traceRw = level;
+		g_s_traceSetup = now;
+		if (anyEnHigh)
+		{
+			LCD_traceViolation(0, "RW changed while EN high", 0, 0);
+		}
+		else if ((g_s_traceFall != 0) && ((now - g_s_traceFall) < LCD_T_HOLD_NS))
+		{
+			LCD_traceViolation(0, "RW hold (tAH)", now - g_s_traceFall, LCD_T_HOLD_NS);
+		}
+	}
+
+	/* the written data is latched on the enable falling edge, it is driven by the controller during a read */
+	if (data != g_s_traceData)
+	{
+		if (now != g_s_traceTime)
+		{
+			fprintf(g_s_traceFile, "#%llu\n", now);
+			g_s_traceTime = now;
+		}
+		LCD_traceBits(data, LCD_IO_MODE, '#');
+		g_s_traceData = data;
+		g_s_traceDataSetup = now;
+		if (anyEnHigh && (g_s_traceRw == LOGIC_LOW))
+		{
+			LCD_traceViolation(0, "data changed while EN high", 0, 0);
+		}
+		else if ((g_s_traceRw == LOGIC_LOW) && (g_s_traceFall != 0) && ((now - g_s_traceFall) < LCD_T_HOLD_NS))
+		{
+			LCD_traceViolation(0, "data hold (tH)", now - g_s_traceFall, LCD_T_HOLD_NS);
+		}
+	}
+
+	for (ctrl=0;ctrl<g_s_traceLcd->s_controllers;ctrl++)
+	{
+		ctrl_Ptr = &g_s_traceCtrl[ctrl];
+		level = LCD_traceLevel(&g_s_traceLcd->s_ctrl[ctrl].s_en);
+		if (level == ctrl_Ptr->s_en)
+		{
+			continue;
+		}
+		if (now != g_s_traceTime)
+		{
+			fprintf(g_s_traceFile, "#%llu\n", now);
+			g_s_traceTime = now;
+		}
+		fprintf(g_s_traceFile, "%u%c\n", level, '%' + ctrl);
+		ctrl_Ptr->s_en = level;
+		if (level == LOGIC_HIGH)
+		{
+			if ((now - g_s_traceSetup) < LCD_T_SETUP_NS)
+			{
+				LCD_traceViolation(ctrl, "RS/RW setup (tAS)", now - g_s_traceSetup, LCD_T_SETUP_NS);
+			}
+			if ((ctrl_Ptr->s_rise != 0) && ((now - ctrl_Ptr->s_rise) < LCD_T_CYCLE_NS))
+			{
+				LCD_traceViolation(ctrl, "enable cycle (tcycE)", now - ctrl_Ptr->s_rise, LCD_T_CYCLE_NS);
+			}
+			/* the busy flag can be read at any time, nothing else */
+			if ((now < ctrl_Ptr->s_busyUntil) && ((g_s_traceRw == LOGIC_LOW) || (g_s_traceRs == LOGIC_HIGH)))
+			{
+				LCD_traceViolation(ctrl, "access while busy (execution time)", now - ctrl_Ptr->s_written,
+								   (uint32)(ctrl_Ptr->s_busyUntil - ctrl_Ptr->s_written));
+			}
+			ctrl_Ptr->s_rise = now;
+		}
+		else
+		{
+			if ((now - ctrl_Ptr->s_rise) < LCD_T_PULSE_NS)
+			{
+				LCD_traceViolation(ctrl, "enable pulse width (PWEH)", now - ctrl_Ptr->s_rise, LCD_T_PULSE_NS);
+			}
+			/* a written byte is latched on this edge, the data must be stable before it and held after it */
+			if (g_s_traceRw == LOGIC_LOW)
+			{
+				if ((now - g_s_traceDataSetup) < LCD_T_DSW_NS)
+				{
+					LCD_traceViolation(ctrl, "data setup (tDSW)", now - g_s_traceDataSetup, LCD_T_DSW_NS);
+				}
+				g_s_traceFall = now;
+			}
+			LCD_traceFalling(ctrl, now);
+		}
+	}
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_traceLevel
+[Description] :	This function is responsible for returning the level of one pin of the traced display
+
+[Args] :
+[in] const DioConfig* a_pin_Ptr:
+a_pin_Ptr: the pin
+[Returns] : LOGIC_HIGH or LOGIC_LOW
+--------------------------------------------------------------------------------------------------------------- */
+static uint8 LCD_traceLevel(const DioConfig* a_pin_Ptr)
+{
+	return HOST_readPin(a_pin_Ptr->s_port, a_pin_Ptr->s_pinNum);
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_traceFalling
+[Description] :	This function is responsible for following the instruction written by an enable falling edge, the
+				byte is complete after two nibbles in 4-bit mode, its execution time starts then. The function sets
+				of the reset sequence after power-on need LCD_RESET1_US and LCD_RESET2_US
+
+[Args] :
+[in] uint8 a_ctrl, HostTime a_now:
+a_ctrl: index of the controller
+a_now: time of the edge
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+static void LCD_traceFalling(uint8 a_ctrl, HostTime a_now)
+{
+	LcdTraceCtrl* ctrl_Ptr = &g_s_traceCtrl[a_ctrl];
+	uint8 value = g_s_traceData;
+	uint32 execUs;
+
+	#if (LCD_IO_MODE == 4)
+		if (ctrl_Ptr->s_mode8)
+		{
+			/* only D4-D7 are connected, the low nibble of the 8-bit instruction is not known */
+			value = g_s_traceData << 4;
+		}
+		else if (ctrl_Ptr->s_phase == 0)
+		{
+			ctrl_Ptr->s_high = g_s_traceData;
+			ctrl_Ptr->s_phase = 1;
+			return;
+		}
+		else
+		{
+			value = (ctrl_Ptr->s_high << 4) | g_s_traceData;
+			ctrl_Ptr->s_phase = 0;
+		}
+	#endif
+	if (g_s_traceRw == LOGIC_HIGH)
+	{
+		/* reads don't start an execution time */
+		return;
+	}
+
+	if (g_s_traceRs == LOGIC_HIGH)
+	{
+		execUs = LCD_EXEC_DATA_US;
+	}
+	else if ((value & 0xE0) == 0x20)
+	{
+		/* function set, the DL bit selects the interface */
+		execUs = LCD_EXEC_US;
+		if (value & 0x10)
+		{
+			if (ctrl_Ptr->s_resets == 0)
+			{
+				execUs = LCD_RESET1_US;
+			}
+			else if (ctrl_Ptr->s_resets == 1)
+			{
+				execUs = LCD_RESET2_US;
+			}
+			if (ctrl_Ptr->s_resets < 0xFF)
+			{
+				ctrl_Ptr->s_resets++;
+			}
+		}
+		else
+		{
+			/* the reset sequence waits are only checked from power-on */
+			ctrl_Ptr->s_resets = 0xFF;
+		}
+		ctrl_Ptr->s_mode8 = (value & 0x10) ? 1 : 0;
+	}
+	else if (value <= 0x03)
+	{
+		execUs = LCD_EXEC_CLEAR_US;
+	}
+	else
+	{
+		execUs = LCD_EXEC_US;
+	}
+	ctrl_Ptr->s_written = a_now;
+	ctrl_Ptr->s_busyUntil = a_now + (HostTime)execUs * 1000;
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_traceViolation
+[Description] :	This function is responsible for counting and printing one timing violation, the count is also
+				written to the violations signal so it shows in the waveform
+
+[Args] :
+[in] uint8 a_ctrl, const char* a_msg_Ptr, HostTime a_ns, uint32 a_limitNs:
+a_ctrl: index of the controller
+a_msg_Ptr: the violated timing
+a_ns: the measured time
+a_limitNs: the datasheet minimum, 0 if the violation has no measured time
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+static void LCD_traceViolation(uint8 a_ctrl, const char* a_msg_Ptr, HostTime a_ns, uint32 a_limitNs)
+{
+	if (g_s_traceViolations < 0xFFFF)
+	{
+		g_s_traceViolations++;
+	}
+	if (a_limitNs != 0)
+	{
+		fprintf(stderr, "lcd_trace: %llu ns: controller %u: %s %llu ns < %lu ns\n",
+				g_s_traceTime, a_ctrl, a_msg_Ptr, a_ns, (unsigned long)a_limitNs);
+	}
+	else
+	{
+		fprintf(stderr, "lcd_trace: %llu ns: controller %u: %s\n", g_s_traceTime, a_ctrl, a_msg_Ptr);
+	}
+	LCD_traceBits(g_s_traceViolations, 16, '$');
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_traceBits
+[Description] :	This function is responsible for writing the value of a vector signal, most significant bit first
+
+[Args] :
+[in] uint16 a_value, uint8 a_width, char a_id:
+a_value: the value
+a_width: number of bits of the signal
+a_id: VCD identifier of the signal
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+static void LCD_traceBits(uint16 a_value, uint8 a_width, char a_id)
+{
+	fputc('b', g_s_traceFile);
+	while (a_width > 0)
+	{
+		a_width--;
+		fputc(((a_value >> a_width) & 1) ? '1' : '0', g_s_traceFile);
+	}
+	fprintf(g_s_traceFile, " %c\n", a_id);
+}
@@ -0,0 +1,70 @@
+/* --------------------------------------------------------------------------------------------------
+[FILE NAME]:		<lcd_trace.h>
+[AUTHOR(S)]:		<Ayman Younis>
+[DATE CREATED]:		<18/10/2026>
+[DESCRIPTION]:		This file contains the lcd waveform tracer header file, it is built with the host emulation
+*					(HOST_EMULATION, see host_emu.h) to record the RS, RW, EN and data lines of one display:
+*
+*					gcc -DHOST_EMULATION lcd_test_app.c lcd.c dio.c host_emu.c lcd_trace.c
+*
+*					Every transition is written with its simulated time to a VCD file which GTKWave can open,
+*					and the bus is checked against the datasheet timings of LCD_CONTROLLER in lcd.h:
+*					enable pulse width and cycle time, RS/RW setup before the enable rising edge, data setup
+*					before the enable falling edge of a write, RS, RW and data hold after it, RS, RW or data
+*					changed while the enable pin is high, and writes sent before the execution time of the
+*					previous instruction (including the waits of the reset sequence after power-on).
+*					Each violation is printed on stderr and counted in the "violations" signal of the file.
+-------------------------------------------------------------------------------------------------- */
+
+/*	LCD_TRACE_H_MAIN will be defined at the lcd trace source file only, so the EXTERN will be removed, also
+*   EXTERN becomes extern in other files that include lcd_trace.h
+*/
+#ifdef LCD_TRACE_H_MAIN
+#define EXTERN
+#else
+#define EXTERN extern
+#endif
+
+#ifndef LCD_TRACE_H_
+#define LCD_TRACE_H_
+
+/*--------------------------------------------- INCLUDES -------------------------------------------*/
+#include "lcd.h"
+
+/*----------------------------------- FUNCTION DECLARATIONS ----------------------------------------------------*/
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_traceOpenInst
+[Description] :	This function is responsible for starting the trace of a display, it must be called before
+				LCD_initInst so the controllers are traced from their power-on state, only one display is traced
+
+[Args] :
+[in] const Lcd* a_lcd_Ptr, const char* a_path_Ptr:
+a_lcd_Ptr: pointer to the display handle
+a_path_Ptr: path of the VCD file to be written
+[Returns] : 1 if the trace is started or 0 if the file can't be created
+--------------------------------------------------------------------------------------------------------------- */
+EXTERN uint8 LCD_traceOpenInst(const Lcd* a_lcd_Ptr, const char* a_path_Ptr);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_traceClose
+[Description] :	This function is responsible for ending the trace at the current simulated time and closing the file
+
+[Args] : This function takes no arguments
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+EXTERN void LCD_traceClose(void);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_traceViolations
+[Description] :	This function is responsible for returning the number of timing violations found since
+				LCD_traceOpenInst, a test program can fail when it is not zero
+
+[Args] : This function takes no arguments
+[Returns] : The number of timing violations, it stops at 65535
+--------------------------------------------------------------------------------------------------------------- */
+EXTERN uint16 LCD_traceViolations(void);
+
+/*------------------------------------- Default display macros ---------------------------------------*/
+#define LCD_traceOpen(a_path_Ptr)						LCD_traceOpenInst(&g_lcd, (a_path_Ptr))
+
+#endif /* LCD_TRACE_H_ */
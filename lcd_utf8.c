@@ -0,0 +1,436 @@
+/* --------------------------------------------------------------------------------------------------
+[FILE NAME]:		<lcd_utf8.c>
+[AUTHOR(S)]:		<Ayman Younis>
+[DATE CREATED]:		<18/10/2026>
+[DESCRIPTION]:		This file contains the lcd UTF-8 text source file, UTF-8 strings are decoded and mapped to the
+*					character ROM, with custom characters for the missing ones.
+[USAGE]:			<See the C include lcd_utf8.h file for a description of each function>
+-------------------------------------------------------------------------------------------------- */
+
+/*--------------------------------------------- INCLUDES ------------------------------------------*/
+#define LCD_UTF8_H_MAIN
+#include "lcd_utf8.h"
+
+/*---------------------------------------- Global Variables ----------------------------------------*/
+#if (LCD_UTF8_ROM == LCD_UTF8_ROM_A00)
+/*	page of each 64 code points below LCD_UTF8_TABLE_END, 0 if none is in the ROM, else its index + 1 */
+static const uint8 g_s_pageIndex[LCD_UTF8_TABLE_END >> 6] FLASH_CONST =
+{
+	0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 4,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 5, 0, 6, 0, 7, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	9, 0, 10, 11
+};
+
+/*	ROM code of each code point of the pages, 0 if it is not in the ROM */
+static const uint8 g_s_pages[11][64] FLASH_CONST =
+{
+	/* U+0080 - U+00BF */
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0xEC, 0xED, 0x00, 0x5C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0xDF, 0x00, 0x00, 0x00, 0x00, 0xE4, 0x00, 0xA5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+	},
+	/* U+00C0 - U+00FF */
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE2,
+		0x00, 0x00, 0x00, 0x00, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0xEE, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xF5, 0x00, 0x00, 0x00
+	},
+	/* U+0380 - U+03BF */
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0xE0, 0xE2, 0x00, 0x00, 0xE3, 0x00, 0x00, 0xF2, 0x00, 0x00, 0x00, 0xE4, 0x00, 0x00, 0x00
+	},
+	/* U+03C0 - U+03FF */
+	{
+		0xF7, 0xE6, 0x00, 0xE5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+	},
+	/* U+2100 - U+213F */
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+	},
+	/* U+2180 - U+21BF */
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x7F, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+	},
+	/* U+2200 - U+223F */
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE8, 0x00, 0x00, 0x00, 0xF3, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+	},
+	/* U+2580 - U+25BF */
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+	},
+	/* U+3000 - U+303F */
+	{
+		0x00, 0xA4, 0xA1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA2, 0xA3, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+	},
+	/* U+3080 - U+30BF */
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDE, 0xDF, 0x00, 0x00, 0x00,
+		0x00, 0xA7, 0xB1, 0xA8, 0xB2, 0xA9, 0xB3, 0xAA, 0xB4, 0xAB, 0xB5, 0xB6, 0x00, 0xB7, 0x00, 0xB8,
+		0x00, 0xB9, 0x00, 0xBA, 0x00, 0xBB, 0x00, 0xBC, 0x00, 0xBD, 0x00, 0xBE, 0x00, 0xBF, 0x00, 0xC0
+	},
+	/* U+30C0 - U+30FF */
+	{
+		0x00, 0xC1, 0x00, 0xAF, 0xC2, 0x00, 0xC3, 0x00, 0xC4, 0x00, 0xC5, 0xC6, 0xC7, 0xC8, 0xC9, 0xCA,
+		0x00, 0x00, 0xCB, 0x00, 0x00, 0xCC, 0x00, 0x00, 0xCD, 0x00, 0x00, 0xCE, 0x00, 0x00, 0xCF, 0xD0,
+		0xD1, 0xD2, 0xD3, 0xAC, 0xD4, 0xAD, 0xD5, 0xAE, 0xD6, 0xD7, 0xD8, 0xD9, 0xDA, 0xDB, 0x00, 0xDC,
+		0x00, 0x00, 0xA6, 0xDD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA5, 0xB0, 0x00, 0x00, 0x00
+	}
+};
+#else
+/*	page of each 64 code points below LCD_UTF8_TABLE_END, 0 if none is in the ROM, else its index + 1 */
+static const uint8 g_s_pageIndex[LCD_UTF8_TABLE_END >> 6] FLASH_CONST =
+{
+	0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 4,
+	5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	6, 0, 0, 0, 7, 0, 8, 0, 9, 10, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 11, 12, 0, 13, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0
+};
+
+/*	ROM code of each code point of the pages, 0 if it is not in the ROM */
+static const uint8 g_s_pages[13][64] FLASH_CONST =
+{
+	/* U+0080 - U+00BF */
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0xB0, 0xB1, 0xB2, 0xB3, 0x00, 0xB5, 0xB6, 0xB7, 0x00, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF
+	},
+	/* U+00C0 - U+00FF */
+	{
+		0xC0, 0xC1, 0xC2, 0xC3, 0xC4, 0xC5, 0xC6, 0xC7, 0xC8, 0xC9, 0xCA, 0xCB, 0xCC, 0xCD, 0xCE, 0xCF,
+		0xD0, 0xD1, 0xD2, 0xD3, 0xD4, 0xD5, 0xD6, 0xD7, 0xD8, 0xD9, 0xDA, 0xDB, 0xDC, 0xDD, 0xDE, 0xDF,
+		0xE0, 0xE1, 0xE2, 0xE3, 0xE4, 0xE5, 0xE6, 0xE7, 0xE8, 0xE9, 0xEA, 0xEB, 0xEC, 0xED, 0xEE, 0xEF,
+		0xF0, 0xF1, 0xF2, 0xF3, 0xF4, 0xF5, 0xF6, 0xF7, 0xF8, 0xF9, 0xFA, 0xFB, 0xFC, 0xFD, 0xFE, 0xFF
+	},
+	/* U+0380 - U+03BF */
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x00, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x90, 0x00, 0x00, 0x9B, 0x9E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB5, 0x00, 0x00, 0x00
+	},
+	/* U+03C0 - U+03FF */
+	{
+		0x93, 0x00, 0x00, 0x95, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+	},
+	/* U+0400 - U+043F */
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x80, 0x00, 0x00, 0x81, 0x00, 0x82, 0x83, 0x84, 0x85, 0x00, 0x86, 0x00, 0x00, 0x00, 0x87,
+		0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x00, 0x8F, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+	},
+	/* U+2000 - U+203F */
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x13, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+	},
+	/* U+2100 - U+213F */
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+	},
+	/* U+2180 - U+21BF */
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x1B, 0x18, 0x1A, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+	},
+	/* U+2200 - U+223F */
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9C, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+	},
+	/* U+2240 - U+227F */
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x1C, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+	},
+	/* U+2580 - U+25BF */
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00
+	},
+	/* U+25C0 - U+25FF */
+	{
+		0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+	},
+	/* U+2640 - U+267F */
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x9D, 0x00, 0x00, 0x00, 0x00, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+	}
+};
+#endif
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_utf8Glyph
+[Description] :	This function is responsible for returning the custom character of a code point which is not in
+				the ROM, it is loaded in the least recently used custom character if it is not loaded yet
+
+[Args] :
+[in] LcdUtf8* a_utf8_Ptr, uint16 a_codePoint:
+a_utf8_Ptr: pointer to the UTF-8 text state
+a_codePoint: the code point
+[Returns] : The code of the custom character, or LCD_UTF8_MISSING if the code point has no rows
+--------------------------------------------------------------------------------------------------------------- */
+static uint8 LCD_utf8Glyph(LcdUtf8* a_utf8_Ptr, uint16 a_codePoint);
+
+/*------------------------------------- FUNCTION Definitions --------------------------------------*/
+/*------------------------------------------ LCD_utf8Init ------------------------------------------*/
+void LCD_utf8Init(LcdUtf8* a_utf8_Ptr, Lcd* a_lcd_Ptr, const uint8* (*a_glyph_Ptr)(uint16 a_codePoint))
+{
+	a_utf8_Ptr->s_lcd_Ptr	= a_lcd_Ptr;
+	a_utf8_Ptr->s_glyph_Ptr	= a_glyph_Ptr;
+	a_utf8_Ptr->s_clock		= 0;
+	a_utf8_Ptr->s_decode	= 0;
+	a_utf8_Ptr->s_need		= 0;
+	LCD_utf8ReleaseGlyphs(a_utf8_Ptr);
+}
+
+/*------------------------------------------- LCD_utf8Map ------------------------------------------*/
+uint8 LCD_utf8Map(uint16 a_codePoint)
+{
+	uint8 page;
+
+	if (a_codePoint < 0x80)
+	{
+		#if (LCD_UTF8_ROM == LCD_UTF8_ROM_A00)
+		if ((a_codePoint == '\\') || (a_codePoint == '~'))
+		{
+			return 0;
+		}
+		#endif
+		return (uint8)a_codePoint;
+	}
+	if (a_codePoint < LCD_UTF8_TABLE_END)
+	{
+		page = FLASH_READ_BYTE(& g_s_pageIndex[a_codePoint >> 6]);
+		if (page == 0)
+		{
+			return 0;
+		}
+		return FLASH_READ_BYTE(& g_s_pages[page - 1][a_codePoint & 0x3F]);
+	}
+	#if (LCD_UTF8_ROM == LCD_UTF8_ROM_A00)
+	if ((uint16)(a_codePoint - LCD_UTF8_HALFWIDTH) < LCD_UTF8_HALFWIDTHS)
+	{
+		return (uint8)(a_codePoint - LCD_UTF8_HALFWIDTH) + LCD_UTF8_HALFWIDTH_CODE;
+	}
+	#endif
+	return 0;
+}
+
+/*------------------------------------ LCD_utf8DisplayCharacter ------------------------------------*/
+void LCD_utf8DisplayCharacter(LcdUtf8* a_utf8_Ptr, uint16 a_codePoint)
+{
+	uint8 code = LCD_utf8Map(a_codePoint);
+
+	if ((a_codePoint == 0) || (a_codePoint == LCD_UTF8_FREE))
+	{
+		/* no glyph is asked for them, LCD_UTF8_FREE would match a free custom character */
+		code = LCD_UTF8_MISSING;
+	}
+	else if (code == 0)
+	{
+		code = LCD_utf8Glyph(a_utf8_Ptr, a_codePoint);
+	}
+	LCD_displayCharacterInst(a_utf8_Ptr->s_lcd_Ptr, code);
+}
+
+/*--------------------------------------- LCD_utf8DisplayByte --------------------------------------*/
+void LCD_utf8DisplayByte(LcdUtf8* a_utf8_Ptr, uint8 a_byte)
+{
+	if ((a_byte & 0xC0) == 0x80)
+	{
+		/* continuation byte */
+		if (a_utf8_Ptr->s_need == 0)
+		{
+			LCD_displayCharacterInst(a_utf8_Ptr->s_lcd_Ptr, LCD_UTF8_MISSING);
+			return;
+		}
+		a_utf8_Ptr->s_decode = (uint16)(a_utf8_Ptr->s_decode << 6) | (a_byte & 0x3F);
+		a_utf8_Ptr->s_need--;
+		if (a_utf8_Ptr->s_need == LCD_UTF8_WIDE)
+		{
+			a_utf8_Ptr->s_need = 0;
+			LCD_displayCharacterInst(a_utf8_Ptr->s_lcd_Ptr, LCD_UTF8_MISSING);
+		}
+		else if (a_utf8_Ptr->s_need == 0)
+		{
+			LCD_utf8DisplayCharacter(a_utf8_Ptr, a_utf8_Ptr->s_decode);
+		}
+		return;
+	}
+	if (a_utf8_Ptr->s_need != 0)
+	{
+		/* the last sequence is cut */
+		a_utf8_Ptr->s_need = 0;
+		LCD_displayCharacterInst(a_utf8_Ptr->s_lcd_Ptr, LCD_UTF8_MISSING);
+	}
+	if (a_byte < 0x80)
+	{
+		LCD_utf8DisplayCharacter(a_utf8_Ptr, a_byte);
+	}
+	else if ((a_byte & 0xE0) == 0xC0)
+	{
+		a_utf8_Ptr->s_decode = a_byte & 0x1F;
+		a_utf8_Ptr->s_need = 1;
+	}
+	else if ((a_byte & 0xF0) == 0xE0)
+	{
+		a_utf8_Ptr->s_decode = a_byte & 0x0F;
+		a_utf8_Ptr->s_need = 2;
+	}
+	else if ((a_byte & 0xF8) == 0xF0)
+	{
+		a_utf8_Ptr->s_need = LCD_UTF8_WIDE | 3;
+	}
+	else
+	{
+		LCD_displayCharacterInst(a_utf8_Ptr->s_lcd_Ptr, LCD_UTF8_MISSING);
+	}
+}
+
+/*-------------------------------------- LCD_utf8DisplayString -------------------------------------*/
+void LCD_utf8DisplayString(LcdUtf8* a_utf8_Ptr, const uint8* a_str_Ptr)
+{
+	a_utf8_Ptr->s_need = 0;
+	while (*a_str_Ptr != '\0')
+	{
+		LCD_utf8DisplayByte(a_utf8_Ptr, *a_str_Ptr++);
+	}
+	if (a_utf8_Ptr->s_need != 0)
+	{
+		a_utf8_Ptr->s_need = 0;
+		LCD_displayCharacterInst(a_utf8_Ptr->s_lcd_Ptr, LCD_UTF8_MISSING);
+	}
+}
+
+/*--------------------------------- LCD_utf8DisplayStringRowColumn ---------------------------------*/
+void LCD_utf8DisplayStringRowColumn(LcdUtf8* a_utf8_Ptr, uint8 a_row, uint8 a_col, const uint8* a_str_Ptr)
+{
+	LCD_goToRowColumnInst(a_utf8_Ptr->s_lcd_Ptr, a_row, a_col);
+	LCD_utf8DisplayString(a_utf8_Ptr, a_str_Ptr);
+}
+
+/*-------------------------------------- LCD_utf8ReleaseGlyphs -------------------------------------*/
+void LCD_utf8ReleaseGlyphs(LcdUtf8* a_utf8_Ptr)
+{
+	uint8 slot;
+
+	for (slot=0;slot<LCD_GLYPHS;slot++)
+	{
+		a_utf8_Ptr->s_slotCode[slot] = LCD_UTF8_FREE;
+		a_utf8_Ptr->s_slotUse[slot] = a_utf8_Ptr->s_clock;
+	}
+}
+
+/*------------------------------------------ LCD_utf8Glyph -----------------------------------------*/
+static uint8 LCD_utf8Glyph(LcdUtf8* a_utf8_Ptr, uint16 a_codePoint)
+{
+	const uint8* rows_Ptr;
+	uint8 rows[LCD_GLYPH_ROWS];
+	uint8 slot;
+	uint8 oldest = LCD_UTF8_FIRST_SLOT;
+	uint8 row;
+
+	/* a fixed number of custom characters, a free one is taken before the least recently used */
+	for (slot=LCD_UTF8_FIRST_SLOT;slot<LCD_GLYPHS;slot++)
+	{
+		if (a_utf8_Ptr->s_slotCode[slot] == a_codePoint)
+		{
+			a_utf8_Ptr->s_slotUse[slot] = ++a_utf8_Ptr->s_clock;
+			return LCD_GLYPH_CODE + slot;
+		}
+		if ((a_utf8_Ptr->s_slotCode[oldest] != LCD_UTF8_FREE) &&
+			((a_utf8_Ptr->s_slotCode[slot] == LCD_UTF8_FREE) ||
+			 ((uint8)(a_utf8_Ptr->s_clock - a_utf8_Ptr->s_slotUse[slot]) >
+			  (uint8)(a_utf8_Ptr->s_clock - a_utf8_Ptr->s_slotUse[oldest]))))
+		{
+			oldest = slot;
+		}
+	}
+	if (a_utf8_Ptr->s_glyph_Ptr == 0)
+	{
+		return LCD_UTF8_MISSING;
+	}
+	rows_Ptr = a_utf8_Ptr->s_glyph_Ptr(a_codePoint);
+	if (rows_Ptr == 0)
+	{
+		return LCD_UTF8_MISSING;
+	}
+	for (row=0;row<LCD_GLYPH_ROWS;row++)
+	{
+		rows[row] = FLASH_READ_BYTE(& rows_Ptr[row]);
+	}
+	LCD_defineCharacterInst(a_utf8_Ptr->s_lcd_Ptr, oldest, rows);
+	a_utf8_Ptr->s_slotCode[oldest] = a_codePoint;
+	a_utf8_Ptr->s_slotUse[oldest] = ++a_utf8_Ptr->s_clock;
+	return LCD_GLYPH_CODE + oldest;
+}
@@ -0,0 +1,183 @@
+/* --------------------------------------------------------------------------------------------------
+[FILE NAME]:		<lcd_utf8.h>
+[AUTHOR(S)]:		<Ayman Younis>
+[DATE CREATED]:		<18/10/2026>
+[DESCRIPTION]:		This file contains the lcd UTF-8 text header file, strings encoded in UTF-8 (translation files
+*					for example) are decoded and each code point is shown with its character of the controller ROM.
+*
+*					The code points are mapped by two tables in the flash: the page of 64 code points gives the
+*					index of a table of 64 ROM codes, so a character costs two flash reads whatever the code point,
+*					there is no search. The tables cover the characters of the A00 (Japanese, with the katakana) or
+*					the A02 (European) character ROM selected by LCD_UTF8_ROM: degree, micro, ohm, the German and
+*					Greek letters, arrows, ..
+*
+*					A character which is not in the ROM is shown with a custom character: the application gives a
+*					function returning its rows, the custom characters from LCD_UTF8_FIRST_SLOT are loaded on demand
+*					and the least recently used one is replaced when all of them are taken. A replaced custom
+*					character changes everywhere it is still shown, at most 8 - LCD_UTF8_FIRST_SLOT of them can be
+*					on the display at the same time.
+-------------------------------------------------------------------------------------------------- */
+
+/*	LCD_UTF8_H_MAIN will be defined at the lcd UTF-8 source file only, so the EXTERN will be removed, also
+*   EXTERN becomes extern in other files that include lcd_utf8.h
+*/
+#ifdef LCD_UTF8_H_MAIN
+#define EXTERN
+#else
+#define EXTERN extern
+#endif
+
+#ifndef LCD_UTF8_H_
+#define LCD_UTF8_H_
+
+/*--------------------------------------------- INCLUDES -------------------------------------------*/
+#include "lcd.h"
+#include "flash_mem.h"
+
+/*---------------------------------- Definitions and configurations --------------------------------*/
+/*	character ROM of the controller, it is printed on the module datasheet */
+#define LCD_UTF8_ROM_A00		0						/**< Japanese: katakana, some Greek letters	*/
+#define LCD_UTF8_ROM_A02		1						/**< European: Latin-1, Cyrillic, Greek		*/
+
+#ifndef LCD_UTF8_ROM
+#define LCD_UTF8_ROM			LCD_UTF8_ROM_A00
+#endif
+
+/*	first custom character used for the characters which are not in the ROM, the ones before it are left to the
+*	application (LCD_defineCharacterInst)
+*/
+#ifndef LCD_UTF8_FIRST_SLOT
+#define LCD_UTF8_FIRST_SLOT		0
+#endif
+
+/*	character shown for a code point which is not in the ROM and has no custom character, or a wrong sequence */
+#define LCD_UTF8_MISSING		'?'
+
+/*	s_slotCode of a free custom character, U+FFFF is a noncharacter and is shown as LCD_UTF8_MISSING like U+0000 */
+#define LCD_UTF8_FREE			0xFFFF
+
+/*	code points mapped by the page tables, the halfwidth katakana after them are mapped by their offset */
+#define LCD_UTF8_TABLE_END		0x3100
+#define LCD_UTF8_HALFWIDTH		0xFF61					/**< U+FF61, the ROM code 0xA1 of A00		*/
+#define LCD_UTF8_HALFWIDTH_CODE	0xA1
+#define LCD_UTF8_HALFWIDTHS		63
+
+/*	internal flag of s_need, the sequence is a code point above U+FFFF which is not displayed */
+#define LCD_UTF8_WIDE			0x80
+
+/*-------------------------------------- Structures and Unions ---------------------------------------*/
+/* ---------------------------------------------------------------------------------------------------
+[Structure Name]: LcdUtf8
+[Structure Description]: This structure is the UTF-8 text state of one display:
+								1. s_lcd_Ptr: the display
+								2. s_glyph_Ptr: function returning the LCD_GLYPH_ROWS rows (FLASH_CONST) of a code
+								   point which is not in the ROM, or 0 if there is none, it may be 0
+								3. s_slotCode: code point loaded in each custom character, LCD_UTF8_FREE if it is
+								   free
+								4. s_slotUse, s_clock: time of the last use of each custom character
+								5. s_decode, s_need: code point decoded so far and continuation bytes still expected
+---------------------------------------------------------------------------------------------------- */
+typedef struct
+{
+	Lcd* s_lcd_Ptr;
+	const uint8* (*s_glyph_Ptr)(uint16 a_codePoint);
+	uint16 s_slotCode[LCD_GLYPHS];
+	uint8 s_slotUse[LCD_GLYPHS];
+	uint8 s_clock;
+	uint16 s_decode;
+	uint8 s_need;
+}LcdUtf8;
+
+/*----------------------------------- FUNCTION DECLARATIONS ----------------------------------------------------*/
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_utf8Init
+[Description] :	This function is responsible for initializing the UTF-8 text state of a display, no custom
+				character is loaded
+
+[Args] :
+[in] LcdUtf8* a_utf8_Ptr, Lcd* a_lcd_Ptr, const uint8* (*a_glyph_Ptr)(uint16 a_codePoint):
+a_utf8_Ptr: pointer to the UTF-8 text state
+a_lcd_Ptr: pointer to the display handle
+a_glyph_Ptr: function returning the rows in the flash of a code point which is not in the ROM, or 0
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+EXTERN void LCD_utf8Init(LcdUtf8* a_utf8_Ptr, Lcd* a_lcd_Ptr, const uint8* (*a_glyph_Ptr)(uint16 a_codePoint));
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_utf8Map
+[Description] :	This function is responsible for returning the ROM code of a code point, in constant time. With the
+				A00 ROM the backslash and the tilde are not in the ROM (it shows the yen sign and an arrow)
+
+[Args] :
+[in] uint16 a_codePoint:
+a_codePoint: the code point
+[Returns] : The ROM code, or 0 if the code point is not in the ROM
+--------------------------------------------------------------------------------------------------------------- */
+EXTERN uint8 LCD_utf8Map(uint16 a_codePoint);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_utf8DisplayCharacter
+[Description] :	This function is responsible for displaying a code point at the cursor, with its ROM character,
+				or else its custom character loaded if needed, or else LCD_UTF8_MISSING. U+0000 and U+FFFF are
+				always shown as LCD_UTF8_MISSING
+
+[Args] :
+[in] LcdUtf8* a_utf8_Ptr, uint16 a_codePoint:
+a_utf8_Ptr: pointer to the UTF-8 text state
+a_codePoint: the code point
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+EXTERN void LCD_utf8DisplayCharacter(LcdUtf8* a_utf8_Ptr, uint16 a_codePoint);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_utf8DisplayByte
+[Description] :	This function is responsible for decoding one byte of a UTF-8 stream, the character is displayed
+				when its last byte is received. A wrong sequence or a code point above U+FFFF is shown as
+				LCD_UTF8_MISSING
+
+[Args] :
+[in] LcdUtf8* a_utf8_Ptr, uint8 a_byte:
+a_utf8_Ptr: pointer to the UTF-8 text state
+a_byte: the byte
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+EXTERN void LCD_utf8DisplayByte(LcdUtf8* a_utf8_Ptr, uint8 a_byte);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_utf8DisplayString
+[Description] :	This function is responsible for displaying a UTF-8 string at the cursor
+
+[Args] :
+[in] LcdUtf8* a_utf8_Ptr, const uint8* a_str_Ptr:
+a_utf8_Ptr: pointer to the UTF-8 text state
+a_str_Ptr: the string, terminated by 0
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+EXTERN void LCD_utf8DisplayString(LcdUtf8* a_utf8_Ptr, const uint8* a_str_Ptr);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_utf8DisplayStringRowColumn
+[Description] :	This function is responsible for displaying a UTF-8 string at a position
+
+[Args] :
+[in] LcdUtf8* a_utf8_Ptr, uint8 a_row, uint8 a_col, const uint8* a_str_Ptr:
+a_utf8_Ptr: pointer to the UTF-8 text state
+a_row, a_col: position of the first character
+a_str_Ptr: the string, terminated by 0
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+EXTERN void LCD_utf8DisplayStringRowColumn(LcdUtf8* a_utf8_Ptr, uint8 a_row, uint8 a_col, const uint8* a_str_Ptr);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_utf8ReleaseGlyphs
+[Description] :	This function is responsible for freeing the custom characters, it is called when none of them is
+				shown anymore, after the screen is cleared for example
+
+[Args] :
+[in] LcdUtf8* a_utf8_Ptr:
+a_utf8_Ptr: pointer to the UTF-8 text state
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+EXTERN void LCD_utf8ReleaseGlyphs(LcdUtf8* a_utf8_Ptr);
+
+#endif /* LCD_UTF8_H_ */
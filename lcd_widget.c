@@ -0,0 +1,228 @@
+/* --------------------------------------------------------------------------------------------------
+[FILE NAME]:		<lcd_widget.c>
+[AUTHOR(S)]:		<Ayman Younis>
+[DATE CREATED]:		<18/10/2026>
+[DESCRIPTION]:		This file contains the lcd live data widgets source file, numeric fields bound to application
+*					variables which are redrawn only when their value changes.
+[USAGE]:			<See the C include lcd_widget.h file for a description of each function>
+-------------------------------------------------------------------------------------------------- */
+
+/*--------------------------------------------- INCLUDES ------------------------------------------*/
+#define LCD_WIDGET_H_MAIN
+#include "lcd_widget.h"
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_widgetRead
+[Description] :	This function is responsible for reading the variable of a widget with the interrupts disabled, so
+				a multi-byte value written by an ISR is never read half updated
+
+[Args] :
+[in] const LcdWidget* a_widget_Ptr:
+a_widget_Ptr: the widget
+[Returns] : The value of the variable
+--------------------------------------------------------------------------------------------------------------- */
+static sint32 LCD_widgetRead(const LcdWidget* a_widget_Ptr);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_widgetDraw
+[Description] :	This function is responsible for writing a value at the position of a widget, aligned and padded to
+				its width, or filled with LCD_WIDGET_OVERFLOW if the value is wider than it
+
+[Args] :
+[in] Lcd* a_lcd_Ptr, const LcdWidget* a_widget_Ptr, sint32 a_value:
+a_lcd_Ptr: pointer to the display handle
+a_widget_Ptr: the widget
+a_value: the value to be displayed
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+static void LCD_widgetDraw(Lcd* a_lcd_Ptr, const LcdWidget* a_widget_Ptr, sint32 a_value);
+
+/*------------------------------------- FUNCTION Definitions --------------------------------------*/
+/*----------------------------------------- LCD_widgetInit -----------------------------------------*/
+void LCD_widgetInit(LcdWidgetSet* a_set_Ptr, Lcd* a_lcd_Ptr)
+{
+	a_set_Ptr->s_lcd_Ptr	= a_lcd_Ptr;
+	a_set_Ptr->s_first_Ptr	= 0;
+	a_set_Ptr->s_turn_Ptr	= 0;
+}
+
+/*------------------------------------------ LCD_widgetAdd -----------------------------------------*/
+void LCD_widgetAdd(LcdWidgetSet* a_set_Ptr, LcdWidget* a_widget_Ptr, const volatile void* a_value_Ptr,
+				   uint8 a_type, uint8 a_row, uint8 a_col, uint8 a_width, uint16 a_intervalMs)
+{
+	LcdWidget* last_Ptr = a_set_Ptr->s_first_Ptr;
+
+	if (a_width > (LCD_NUMBER_LENGTH - 1))
+	{
+		a_width = LCD_NUMBER_LENGTH - 1;
+	}
+	a_widget_Ptr->s_value_Ptr	= a_value_Ptr;
+	a_widget_Ptr->s_shown		= 0;
+	a_widget_Ptr->s_intervalMs	= a_intervalMs;
+	a_widget_Ptr->s_drawnMs		= 0;
+	a_widget_Ptr->s_type		= a_type;
+	a_widget_Ptr->s_base		= 10;
+	a_widget_Ptr->s_width		= a_width;
+	a_widget_Ptr->s_flags		= 0;
+	a_widget_Ptr->s_row			= a_row;
+	a_widget_Ptr->s_col			= a_col;
+	a_widget_Ptr->s_next		= 0;
+	if (last_Ptr == 0)
+	{
+		a_set_Ptr->s_first_Ptr = a_widget_Ptr;
+		a_set_Ptr->s_turn_Ptr = a_widget_Ptr;
+		return;
+	}
+	while (last_Ptr->s_next != 0)
+	{
+		last_Ptr = last_Ptr->s_next;
+	}
+	last_Ptr->s_next = a_widget_Ptr;
+}
+
+/*---------------------------------------- LCD_widgetFormat ----------------------------------------*/
+void LCD_widgetFormat(LcdWidget* a_widget_Ptr, uint8 a_base, uint8 a_flags)
+{
+	a_widget_Ptr->s_base = a_base;
+	a_widget_Ptr->s_flags = a_flags & (LCD_WIDGET_LEFT | LCD_WIDGET_ZERO);
+}
+
+/*-------------------------------------- LCD_widgetInvalidate --------------------------------------*/
+void LCD_widgetInvalidate(LcdWidgetSet* a_set_Ptr)
+{
+	LcdWidget* widget_Ptr;
+
+	for (widget_Ptr=a_set_Ptr->s_first_Ptr;widget_Ptr!=0;widget_Ptr=widget_Ptr->s_next)
+	{
+		widget_Ptr->s_flags &= (uint8)~LCD_WIDGET_SHOWN;
+	}
+}
+
+/*---------------------------------------- LCD_widgetRefresh ---------------------------------------*/
+uint8 LCD_widgetRefresh(LcdWidgetSet* a_set_Ptr, uint16 a_nowMs, uint8 a_maxDraws)
+{
+	LcdWidget* widget_Ptr = a_set_Ptr->s_turn_Ptr;
+	LcdWidget* start_Ptr = widget_Ptr;
+	uint8 draws = 0;
+	sint32 value;
+
+	if ((widget_Ptr == 0) || (a_maxDraws == 0))
+	{
+		return 0;
+	}
+	LCD_beginBatch();
+	do
+	{
+		if (!(widget_Ptr->s_flags & LCD_WIDGET_SHOWN))
+		{
+			value = LCD_widgetRead(widget_Ptr);
+			LCD_widgetDraw(a_set_Ptr->s_lcd_Ptr, widget_Ptr, value);
+			widget_Ptr->s_shown = value;
+			widget_Ptr->s_flags |= LCD_WIDGET_SHOWN;
+			widget_Ptr->s_drawnMs = a_nowMs;
+			draws++;
+		}
+		else if ((uint16)(a_nowMs - widget_Ptr->s_drawnMs) >= widget_Ptr->s_intervalMs)
+		{
+			value = LCD_widgetRead(widget_Ptr);
+			if (value != widget_Ptr->s_shown)
+			{
+				LCD_widgetDraw(a_set_Ptr->s_lcd_Ptr, widget_Ptr, value);
+				widget_Ptr->s_shown = value;
+				widget_Ptr->s_drawnMs = a_nowMs;
+				draws++;
+			}
+			else
+			{
+				/* the widget stays due without its age wrapping around after 65 seconds */
+				widget_Ptr->s_drawnMs = a_nowMs - widget_Ptr->s_intervalMs;
+			}
+		}
+		widget_Ptr = (widget_Ptr->s_next != 0) ? widget_Ptr->s_next : a_set_Ptr->s_first_Ptr;
+	}while ((widget_Ptr != start_Ptr) && (draws < a_maxDraws));
+	a_set_Ptr->s_turn_Ptr = widget_Ptr;
+	LCD_endBatch();
+	return draws;
+}
+
+/*----------------------------------------- LCD_widgetRead ----------------------------------------*/
+static sint32 LCD_widgetRead(const LcdWidget* a_widget_Ptr)
+{
+	uint8 sreg = SREG;
+	sint32 value;
+
+	CLEARBIT(SREG, LCD_WIDGET_SREG_I);
+	switch (a_widget_Ptr->s_type)
+	{
+	case LCD_WIDGET_U8:
+		value = *(const volatile uint8*)a_widget_Ptr->s_value_Ptr;
+		break;
+	case LCD_WIDGET_S8:
+		value = *(const volatile sint8*)a_widget_Ptr->s_value_Ptr;
+		break;
+	case LCD_WIDGET_U16:
+		value = *(const volatile uint16*)a_widget_Ptr->s_value_Ptr;
+		break;
+	case LCD_WIDGET_S16:
+		value = *(const volatile sint16*)a_widget_Ptr->s_value_Ptr;
+		break;
+	default:
+		value = *(const volatile sint32*)a_widget_Ptr->s_value_Ptr;
+		break;
+	}
+	SREG = sreg;
+	return value;
+}
+
+/*----------------------------------------- LCD_widgetDraw ----------------------------------------*/
+static void LCD_widgetDraw(Lcd* a_lcd_Ptr, const LcdWidget* a_widget_Ptr, sint32 a_value)
+{
+	uint8 number[LCD_NUMBER_LENGTH];
+	uint8 field[LCD_NUMBER_LENGTH];
+	uint8 width = a_widget_Ptr->s_width;
+	uint8 length = LCD_formatNumber(a_value, number, a_widget_Ptr->s_base);
+	uint8 pad;
+	uint8 out = 0;
+	uint8 in = 0;
+
+	if (length > width)
+	{
+		while (out < width)
+		{
+			field[out++] = LCD_WIDGET_OVERFLOW;
+		}
+	}
+	else
+	{
+		pad = width - length;
+		if (a_widget_Ptr->s_flags & LCD_WIDGET_ZERO)
+		{
+			/* the zeros go after the sign */
+			if (number[0] == '-')
+			{
+				field[out++] = number[in++];
+			}
+			while (pad--)
+			{
+				field[out++] = '0';
+			}
+		}
+		else if (!(a_widget_Ptr->s_flags & LCD_WIDGET_LEFT))
+		{
+			while (pad--)
+			{
+				field[out++] = ' ';
+			}
+		}
+		while (number[in] != '\0')
+		{
+			field[out++] = number[in++];
+		}
+		while (out < width)
+		{
+			field[out++] = ' ';
+		}
+	}
+	field[out] = '\0';
+	LCD_displayStringRowColumnInst(a_lcd_Ptr, a_widget_Ptr->s_row, a_widget_Ptr->s_col, field);
+}
@@ -0,0 +1,173 @@
+/* --------------------------------------------------------------------------------------------------
+[FILE NAME]:		<lcd_widget.h>
+[AUTHOR(S)]:		<Ayman Younis>
+[DATE CREATED]:		<18/10/2026>
+[DESCRIPTION]:		This file contains the lcd live data widgets header file, numeric fields bound to application
+*					variables which are redrawn only when their value changes.
+*
+*					Each widget is registered once with the address of its variable, its type, its position, its
+*					width and its minimum refresh interval. The main loop calls LCD_widgetRefresh with the current
+*					time in milli seconds, the widgets whose interval has elapsed read their variable and only the
+*					ones with a new value are converted and written, padded to their width so the old digits are
+*					overwritten. A screen of dozens of fields costs a few comparisons per call when nothing changes.
+*
+*					The refresh goes round the widgets starting after the last one it checked, so with a limit of
+*					drawn widgets per call a fast changing field can't starve the others. The variables may be
+*					written by an ISR, they are read with the interrupts disabled.
+-------------------------------------------------------------------------------------------------- */
+
+/*	LCD_WIDGET_H_MAIN will be defined at the lcd widget source file only, so the EXTERN will be removed, also
+*   EXTERN becomes extern in other files that include lcd_widget.h
+*/
+#ifdef LCD_WIDGET_H_MAIN
+#define EXTERN
+#else
+#define EXTERN extern
+#endif
+
+#ifndef LCD_WIDGET_H_
+#define LCD_WIDGET_H_
+
+/*--------------------------------------------- INCLUDES -------------------------------------------*/
+#include "lcd.h"
+
+/*---------------------------------- Definitions and configurations --------------------------------*/
+/*	types of the widget variables */
+#define LCD_WIDGET_U8			0						/**< uint8 variable							*/
+#define LCD_WIDGET_S8			1						/**< sint8 variable							*/
+#define LCD_WIDGET_U16			2						/**< uint16 variable						*/
+#define LCD_WIDGET_S16			3						/**< sint16 variable						*/
+#define LCD_WIDGET_S32			4						/**< sint32 variable						*/
+
+/*	format flags of LCD_widgetFormat, the default is right aligned and padded with spaces */
+#define LCD_WIDGET_LEFT			0x01					/**< left aligned, padded with spaces		*/
+#define LCD_WIDGET_ZERO			0x02					/**< right aligned, padded with zeros		*/
+
+/*	internal flag, s_shown holds the value on the display */
+#define LCD_WIDGET_SHOWN		0x80
+
+/*	character filling a widget whose value is wider than it */
+#define LCD_WIDGET_OVERFLOW		'#'
+
+/*	SREG bit of the global interrupt enable */
+#define LCD_WIDGET_SREG_I		7
+
+/*-------------------------------------- Structures and Unions ---------------------------------------*/
+/* ---------------------------------------------------------------------------------------------------
+[Structure Name]: LcdWidget
+[Structure Description]: This structure is one live data field, it is owned by the application and must stay
+						 valid while it is registered:
+								1. s_value_Ptr: the variable displayed by the widget
+								2. s_shown: value on the display, valid if s_flags has LCD_WIDGET_SHOWN
+								3. s_intervalMs: minimum time between two draws of the widget, up to 32767 ms
+								4. s_drawnMs: time of the last draw
+								5. s_type: LCD_WIDGET_U8 .. LCD_WIDGET_S32
+								6. s_base: number base, 10 by default
+								7. s_width: characters taken on the display, up to LCD_NUMBER_LENGTH - 1
+								8. s_flags: LCD_WIDGET_LEFT, LCD_WIDGET_ZERO and LCD_WIDGET_SHOWN
+								9. s_row, s_col: position of the first character
+								10. s_next: next registered widget
+---------------------------------------------------------------------------------------------------- */
+typedef struct LcdWidget
+{
+	const volatile void* s_value_Ptr;
+	sint32 s_shown;
+	uint16 s_intervalMs;
+	uint16 s_drawnMs;
+	uint8 s_type;
+	uint8 s_base;
+	uint8 s_width;
+	uint8 s_flags;
+	uint8 s_row;
+	uint8 s_col;
+	struct LcdWidget* s_next;
+}LcdWidget;
+
+/* ---------------------------------------------------------------------------------------------------
+[Structure Name]: LcdWidgetSet
+[Structure Description]: This structure is the list of the widgets of one display:
+								1. s_lcd_Ptr: the display the widgets are drawn on
+								2. s_first_Ptr: first registered widget
+								3. s_turn_Ptr: widget checked first by the next refresh
+---------------------------------------------------------------------------------------------------- */
+typedef struct
+{
+	Lcd* s_lcd_Ptr;
+	LcdWidget* s_first_Ptr;
+	LcdWidget* s_turn_Ptr;
+}LcdWidgetSet;
+
+/*----------------------------------- FUNCTION DECLARATIONS ----------------------------------------------------*/
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_widgetInit
+[Description] :	This function is responsible for initializing an empty widget list of a display
+
+[Args] :
+[in] LcdWidgetSet* a_set_Ptr, Lcd* a_lcd_Ptr:
+a_set_Ptr: pointer to the widget list
+a_lcd_Ptr: pointer to the display handle
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+EXTERN void LCD_widgetInit(LcdWidgetSet* a_set_Ptr, Lcd* a_lcd_Ptr);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_widgetAdd
+[Description] :	This function is responsible for registering a widget at the end of the list, it is decimal and
+				right aligned till LCD_widgetFormat changes it, and it is drawn by the next refresh
+
+[Args] :
+[in] LcdWidgetSet* a_set_Ptr, LcdWidget* a_widget_Ptr, const volatile void* a_value_Ptr, uint8 a_type,
+	 uint8 a_row, uint8 a_col, uint8 a_width, uint16 a_intervalMs:
+a_set_Ptr: pointer to the widget list
+a_widget_Ptr: the widget to be registered
+a_value_Ptr: the variable to be displayed
+a_type: LCD_WIDGET_U8 .. LCD_WIDGET_S32
+a_row, a_col: position of the first character
+a_width: characters taken on the display
+a_intervalMs: minimum time between two draws, 0 draws each change
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+EXTERN void LCD_widgetAdd(LcdWidgetSet* a_set_Ptr, LcdWidget* a_widget_Ptr, const volatile void* a_value_Ptr,
+						  uint8 a_type, uint8 a_row, uint8 a_col, uint8 a_width, uint16 a_intervalMs);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_widgetFormat
+[Description] :	This function is responsible for changing the number base and the alignment of a widget, it is
+				drawn again by the next refresh
+
+[Args] :
+[in] LcdWidget* a_widget_Ptr, uint8 a_base, uint8 a_flags:
+a_widget_Ptr: the widget
+a_base: number base from 2 to 35
+a_flags: 0, LCD_WIDGET_LEFT or LCD_WIDGET_ZERO
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+EXTERN void LCD_widgetFormat(LcdWidget* a_widget_Ptr, uint8 a_base, uint8 a_flags);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_widgetInvalidate
+[Description] :	This function is responsible for drawing all the widgets again by the next refresh, it is called
+				after the screen is cleared or overwritten by the application
+
+[Args] :
+[in] LcdWidgetSet* a_set_Ptr:
+a_set_Ptr: pointer to the widget list
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+EXTERN void LCD_widgetInvalidate(LcdWidgetSet* a_set_Ptr);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : LCD_widgetRefresh
+[Description] :	This function is responsible for drawing the widgets whose interval has elapsed and whose variable
+				has changed, the writes of one call are sent as one batch
+
+[Args] :
+[in] LcdWidgetSet* a_set_Ptr, uint16 a_nowMs, uint8 a_maxDraws:
+a_set_Ptr: pointer to the widget list
+a_nowMs: current time in milli seconds, it may wrap around
+a_maxDraws: maximum widgets drawn by this call, the next call goes on after the last checked one
+[Returns] : The number of drawn widgets
+--------------------------------------------------------------------------------------------------------------- */
+EXTERN uint8 LCD_widgetRefresh(LcdWidgetSet* a_set_Ptr, uint16 a_nowMs, uint8 a_maxDraws);
+
+#endif /* LCD_WIDGET_H_ */
@@ -14,6 +14,25 @@
 #define F_CPU 1000000UL
 #endif
 
+#ifdef HOST_EMULATION
+/* host_emu.h emulates the delays by advancing a simulated time */
+#include "host_emu.h"
+#else
 #include <util/delay.h>
+#endif
+
+/*	number of CPU cycles of a time in nano seconds, rounded up so a delay is never shorter than asked, it is 0
+*	when the time is shorter than one cycle
+*/
+#define OSC_NS_TO_CYCLES(a_ns)	((((a_ns) * (F_CPU / 1000UL)) + 999999UL) / 1000000UL)
+
+/*	cycle exact delay of a constant time in nano seconds, nothing is inserted if it is shorter than one cycle */
+#if defined(__AVR__)
+#define OSC_DELAY_NS(a_ns)		__builtin_avr_delay_cycles(OSC_NS_TO_CYCLES(a_ns))
+#elif defined(HOST_EMULATION)
+#define OSC_DELAY_NS(a_ns)		HOST_delayCycles(OSC_NS_TO_CYCLES(a_ns))
+#else
+#define OSC_DELAY_NS(a_ns)		_delay_us((a_ns) / 1000.0)
+#endif
 
 #endif /*osc.h*/
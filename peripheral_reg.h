@@ -10,6 +10,44 @@
 #define PERIPHERAL_REG_H_
 
 /*---------------------------------- Definitions and configurations --------------------------------*/
+/*	HOST_EMULATION builds the drivers for the PC, the registers are then emulated in RAM by host_emu.c at the
+*	same addresses
+*/
+#ifdef HOST_EMULATION
+#include "host_emu.h"
+
+/*------------------------------------------ DDR Registers -----------------------------------------*/
+#define DDRA HOST_REG(0x3A)
+#define DDRB HOST_REG(0x37)
+#define DDRC HOST_REG(0x34)
+#define DDRD HOST_REG(0x31)
+
+/*----------------------------------------- PORT Registers -----------------------------------------*/
+#define PORTA HOST_REG(0x3B)
+#define PORTB HOST_REG(0x38)
+#define PORTC HOST_REG(0x35)
+#define PORTD HOST_REG(0x32)
+
+/*------------------------------------------ PIN Registers -----------------------------------------*/
+#define PINA HOST_REG(0x39)
+#define PINB HOST_REG(0x36)
+#define PINC HOST_REG(0x33)
+#define PIND HOST_REG(0x30)
+
+/*------------------------------------------ Timer Registers -----------------------------------------*/
+#define TCNT0 HOST_REG(0x52)
+#define OCR0 HOST_REG(0x5C)
+#define TIMSK HOST_REG(0x59)
+#define TIFR HOST_REG(0x58)
+#define TCCR0 HOST_REG(0x53)
+
+/*------------------------------------------ Status Register -----------------------------------------*/
+#define SREG HOST_REG(0x5F)
+
+/*------------------------------------------ MCU Control Register -----------------------------------------*/
+#define MCUCR HOST_REG(0x55)
+
+#else
 
 /*------------------------------------------ DDR Registers -----------------------------------------*/
 #define DDRA (*((volatile uint8 *)0x3A))
@@ -31,8 +69,17 @@
 
 /*------------------------------------------ Timer Registers -----------------------------------------*/
 #define TCNT0 (*((volatile uint8 *)0x52))
-#define OCR0 (*((volatile uint8 *)0x51))
-#define TIMSK (*((volatile uint8 *)0x57))
+#define OCR0 (*((volatile uint8 *)0x5C))
+#define TIMSK (*((volatile uint8 *)0x59))
+#define TIFR (*((volatile uint8 *)0x58))
 #define TCCR0 (*((volatile uint8 *)0x53))
 
+/*------------------------------------------ Status Register -----------------------------------------*/
+#define SREG (*((volatile uint8 *)0x5F))
+
+/*------------------------------------------ MCU Control Register -----------------------------------------*/
+#define MCUCR (*((volatile uint8 *)0x55))
+
+#endif
+
 #endif /*peripheral_reg.h*/
\ No newline at end of file
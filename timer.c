@@ -0,0 +1,184 @@
+/* --------------------------------------------------------------------------------------------------
+[FILE NAME]:		<timer.c>
+[AUTHOR(S)]:		<Ayman Younis>
+[DATE CREATED]:		<18/10/2026>
+[DESCRIPTION]:		This file contains the Timer0 source file, the free running timer, its overflow interrupt and the
+*					idle sleep waits woken by its compare match interrupt.
+[USAGE]:			<See the C include timer.h file for a description of each function>
+-------------------------------------------------------------------------------------------------- */
+
+/*--------------------------------------------- INCLUDES ------------------------------------------*/
+#define TIMER_H_MAIN
+#include "timer.h"
+
+/*------------------------------------------ Global Variables ------------------------------------------*/
+/* ---------------------------------------------------------------------------------------------------
+[Variable Name]: g_s_timer0Overflows
+[Variable Description]: The tick count without its low byte, incremented by the overflow interrupt
+---------------------------------------------------------------------------------------------------- */
+static volatile uint32 g_s_timer0Overflows;
+
+/*------------------------------------- FUNCTION Definitions --------------------------------------*/
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : TIMER0_init
+[Description] :	This function is responsible for starting Timer0 in normal mode with the TIMER0_CLOCK prescaler and
+				its overflow interrupt, the tick count starts from 0
+
+[Args] : This function takes no arguments
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+void TIMER0_init(void)
+{
+	/* normal mode, OC0 disconnected */
+	TCCR0 = TIMER0_STOP;
+	TCNT0 = 0;
+	g_s_timer0Overflows = 0;
+	/* clear a pending overflow by writing one to its flag */
+	TIFR = (1 << TIMER0_TOV0);
+	SETBIT(TIMSK, TIMER0_TOIE0);
+	TCCR0 = TIMER0_CLOCK;
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : TIMER0_ticks
+[Description] :	This function is responsible for returning the 16-bit tick count, TCNT0 and the overflows counted
+				by the interrupt are read with the interrupts disabled, an overflow not serviced yet is counted
+
+[Args] : This function takes no arguments
+[Returns] : The ticks since TIMER0_init, it wraps after 65536 ticks so only differences are meaningful
+--------------------------------------------------------------------------------------------------------------- */
+uint16 TIMER0_ticks(void)
+{
+#ifdef HOST_EMULATION
+	return (uint16)((HOST_timeNs() * (F_CPU / 1000UL)) / (TIMER0_DIVIDER * 1000000ULL));
+#else
+	uint8 sreg = SREG;
+	uint8 high;
+	uint8 count;
+
+	CLEARBIT(SREG, TIMER0_SREG_I);
+	count = TCNT0;
+	high = (uint8)g_s_timer0Overflows;
+	/* TCNT0 wrapped after the last interrupt, the count read is then small */
+	if (BITISSET(TIFR, TIMER0_TOV0) && (count < 0x80))
+	{
+		high++;
+	}
+	SREG = sreg;
+	return ((uint16)high << 8) | count;
+#endif
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : TIMER0_ticksLong
+[Description] :	This function is responsible for returning the 32-bit tick count, read as TIMER0_ticks, for the
+				times longer than the wrap of the 16-bit count
+
+[Args] : This function takes no arguments
+[Returns] : The ticks since TIMER0_init, it wraps after 2^32 ticks so only differences are meaningful
+--------------------------------------------------------------------------------------------------------------- */
+uint32 TIMER0_ticksLong(void)
+{
+#ifdef HOST_EMULATION
+	return (uint32)((HOST_timeNs() * (F_CPU / 1000UL)) / (TIMER0_DIVIDER * 1000000ULL));
+#else
+	uint8 sreg = SREG;
+	uint32 high;
+	uint8 count;
+
+	CLEARBIT(SREG, TIMER0_SREG_I);
+	count = TCNT0;
+	high = g_s_timer0Overflows;
+	/* TCNT0 wrapped after the last interrupt, the count read is then small */
+	if (BITISSET(TIFR, TIMER0_TOV0) && (count < 0x80))
+	{
+		high++;
+	}
+	SREG = sreg;
+	return (high << 8) | count;
+#endif
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : TIMER0_sleepUs
+[Description] :	This function is responsible for waiting at least a number of micro seconds in idle sleep, the wait
+				is cut in parts of TIMER0_SLEEP_CHUNK ticks. The end is checked with the interrupts disabled and
+				"sei" is followed by "sleep", the AVR executes the instruction after sei before any interrupt, so a
+				compare match can't be serviced between the check and the sleep and leave the CPU asleep
+
+[Args] :
+[in] uint16 a_us:
+a_us: the wait in micro seconds
+[Returns] : 1 after the wait, or 0 at once if the timer is stopped or the interrupts are disabled
+--------------------------------------------------------------------------------------------------------------- */
+uint8 TIMER0_sleepUs(uint16 a_us)
+{
+#ifdef HOST_EMULATION
+	HOST_delayNs((HostTime)a_us * 1000ULL);
+	return 1;
+#else
+	uint32 left = TIMER0_US_TO_TICKS(a_us) + 1;
+	uint16 part;
+	uint16 end;
+
+	if (BITISCLEAR(SREG, TIMER0_SREG_I) || ((TCCR0 & 0x07) == TIMER0_STOP))
+	{
+		/* nothing would wake the CPU up */
+		return 0;
+	}
+	MCUCR = (MCUCR & (uint8)~TIMER0_SLEEP_MODE) | (1 << TIMER0_SE);
+	while (left != 0)
+	{
+		part = (left > TIMER0_SLEEP_CHUNK) ? (uint16)TIMER0_SLEEP_CHUNK : (uint16)left;
+		left -= part;
+		end = TIMER0_ticks() + part;
+		/* the compare match comes when TCNT0 reaches the low byte of the end, at most 256 ticks early */
+		OCR0 = (uint8)end;
+		TIFR = (1 << TIMER0_OCF0);
+		SETBIT(TIMSK, TIMER0_OCIE0);
+		while (1)
+		{
+			CLEARBIT(SREG, TIMER0_SREG_I);
+			if ((sint16)(TIMER0_ticks() - end) >= 0)
+			{
+				SETBIT(SREG, TIMER0_SREG_I);
+				break;
+			}
+			__asm__ __volatile__ ("sei" "\n\t" "sleep" ::: "memory");
+		}
+	}
+	CLEARBIT(TIMSK, TIMER0_OCIE0);
+	CLEARBIT(MCUCR, TIMER0_SE);
+	return 1;
+#endif
+}
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : TIMER0_OVF_VECTOR
+[Description] :	This function is the Timer0 overflow interrupt, it counts the ticks above the low byte
+
+[Args] : This function takes no arguments
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+#if defined(__AVR__)
+void TIMER0_OVF_VECTOR(void) __attribute__ ((signal, used, externally_visible));
+void TIMER0_OVF_VECTOR(void)
+{
+	g_s_timer0Overflows++;
+}
+#endif
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : TIMER0_COMP_VECTOR
+[Description] :	This function is the Timer0 compare match interrupt, it only wakes the CPU from the sleep of
+				TIMER0_sleepUs
+
+[Args] : This function takes no arguments
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+#if defined(__AVR__)
+void TIMER0_COMP_VECTOR(void) __attribute__ ((signal, used, externally_visible));
+void TIMER0_COMP_VECTOR(void)
+{
+}
+#endif
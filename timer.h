@@ -0,0 +1,135 @@
+/* --------------------------------------------------------------------------------------------------
+[FILE NAME]:		<timer.h>
+[AUTHOR(S)]:		<Ayman Younis>
+[DATE CREATED]:		<18/10/2026>
+[DESCRIPTION]:		This file contains the Timer0 header file (ATmega16/32 registers), the timer runs free in normal
+*					mode and its overflow interrupt extends TCNT0 to a 32-bit tick count used to measure time,
+*					its compare match interrupt wakes the CPU from the idle sleep of TIMER0_sleepUs.
+*
+*					The interrupt vectors are declared by number since avr/io.h can't be included with
+*					peripheral_reg.h, the global interrupts must be enabled by the application (sei).
+*					With HOST_EMULATION the ticks are computed from the simulated time of host_emu.h.
+-------------------------------------------------------------------------------------------------- */
+
+/*	TIMER_H_MAIN will be defined at the timer source file only, so the EXTERN will be removed, also
+*   EXTERN becomes extern in other files that include timer.h
+*/
+#ifdef TIMER_H_MAIN
+#define EXTERN
+#else
+#define EXTERN extern
+#endif
+
+#ifndef TIMER_H_
+#define TIMER_H_
+
+/*--------------------------------------------- INCLUDES -------------------------------------------*/
+#include "peripheral_reg.h"
+#include "std_type.h"
+#include "osc.h"
+#include "common_macro.h"
+
+/*---------------------------------- Definitions and configurations --------------------------------*/
+/*	clock select bits CS02:CS00 of TCCR0 */
+#define TIMER0_STOP				0x00					/**< no clock, timer stopped				*/
+#define TIMER0_CLK_1			0x01					/**< F_CPU									*/
+#define TIMER0_CLK_8			0x02					/**< F_CPU / 8								*/
+#define TIMER0_CLK_64			0x03					/**< F_CPU / 64								*/
+#define TIMER0_CLK_256			0x04					/**< F_CPU / 256							*/
+#define TIMER0_CLK_1024			0x05					/**< F_CPU / 1024							*/
+
+/*	prescaler of the free running timer, a tick is TIMER0_DIVIDER / F_CPU and the 16-bit count wraps after
+*	65536 ticks: 8us and 524ms with F_CPU / 8 at 1MHz, the 32-bit count after 9.5 hours. Define TIMER0_CLOCK and
+*	its TIMER0_DIVIDER together to change it, F_CPU / 64 at 16MHz for example
+*/
+#ifndef TIMER0_CLOCK
+#define TIMER0_CLOCK			TIMER0_CLK_8
+#define TIMER0_DIVIDER			8UL
+#endif
+
+/*	micro seconds of a number of ticks: the whole micro seconds of a tick plus its fraction, whose terms are
+*	divided by 1000 so the products fit in 32 bits. A tick is 0.5us with F_CPU / 8 at 16MHz and 3.2us with
+*	F_CPU / 64 at 20MHz, the multiplication must not come after a truncating division
+*/
+#define TIMER0_TICK_US			((TIMER0_DIVIDER * 1000000UL) / F_CPU)
+#define TIMER0_TICK_REM			(((TIMER0_DIVIDER * 1000000UL) % F_CPU) / 1000UL)
+#define TIMER0_TICKS_TO_US(a_ticks)	((uint32)(a_ticks) * TIMER0_TICK_US + \
+									 ((uint32)(a_ticks) * TIMER0_TICK_REM) / (F_CPU / 1000UL))
+
+/*	ticks of a number of micro seconds, rounded up */
+#define TIMER0_US_TO_TICKS(a_us)	(((uint32)(a_us) * (F_CPU / 1000UL) + (TIMER0_DIVIDER * 1000UL) - 1) / \
+									 (TIMER0_DIVIDER * 1000UL))
+
+/*	register bits */
+#define TIMER0_TOIE0			0						/**< TIMSK: overflow interrupt enable		*/
+#define TIMER0_OCIE0			1						/**< TIMSK: compare match interrupt enable	*/
+#define TIMER0_TOV0				0						/**< TIFR: overflow flag					*/
+#define TIMER0_OCF0				1						/**< TIFR: compare match flag				*/
+#define TIMER0_SREG_I			7						/**< SREG: global interrupt enable			*/
+#define TIMER0_SLEEP_MODE		0xF0					/**< MCUCR: SE and SM2:0, 0 with SE is idle	*/
+#if defined(__AVR_ATmega16__)
+#define TIMER0_SE				6						/**< MCUCR: sleep enable					*/
+#else
+#define TIMER0_SE				7						/**< MCUCR: sleep enable					*/
+#endif
+
+/*	ATmega16/32 vector numbers, avr/interrupt.h uses the same __vector_N names */
+#if defined(__AVR_ATmega16__)
+#define TIMER0_OVF_VECTOR		__vector_9
+#define TIMER0_COMP_VECTOR		__vector_19
+#else
+#define TIMER0_OVF_VECTOR		__vector_11
+#define TIMER0_COMP_VECTOR		__vector_10
+#endif
+
+/*	longest part of a sleep, half the tick count range so the end is never taken for the past */
+#define TIMER0_SLEEP_CHUNK		0x7FFFUL
+
+/*----------------------------------- FUNCTION DECLARATIONS ----------------------------------------------------*/
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : TIMER0_init
+[Description] :	This function is responsible for starting Timer0 in normal mode with the TIMER0_CLOCK prescaler and
+				its overflow interrupt, the tick count starts from 0
+
+[Args] : This function takes no arguments
+[Returns] : This function return void
+--------------------------------------------------------------------------------------------------------------- */
+EXTERN void TIMER0_init(void);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : TIMER0_ticks
+[Description] :	This function is responsible for returning the 16-bit tick count, TCNT0 and the overflows counted
+				by the interrupt are read with the interrupts disabled, an overflow not serviced yet is counted
+
+[Args] : This function takes no arguments
+[Returns] : The ticks since TIMER0_init, it wraps after 65536 ticks so only differences are meaningful
+--------------------------------------------------------------------------------------------------------------- */
+EXTERN uint16 TIMER0_ticks(void);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : TIMER0_ticksLong
+[Description] :	This function is responsible for returning the 32-bit tick count, read as TIMER0_ticks, for the
+				times longer than the wrap of the 16-bit count
+
+[Args] : This function takes no arguments
+[Returns] : The ticks since TIMER0_init, it wraps after 2^32 ticks so only differences are meaningful
+--------------------------------------------------------------------------------------------------------------- */
+EXTERN uint32 TIMER0_ticksLong(void);
+
+/* ---------------------------------------------------------------------------------------------------------------
+[Function Name] : TIMER0_sleepUs
+[Description] :	This function is responsible for waiting at least a number of micro seconds in idle sleep instead of
+				spinning: the compare match interrupt is armed at the end tick and the CPU sleeps till an interrupt
+				wakes it, the other interrupts are serviced meanwhile and the CPU sleeps again till the end is
+				reached. Timer0 must be started by TIMER0_init and the interrupts enabled, the wait is at most one
+				tick longer
+
+[Args] :
+[in] uint16 a_us:
+a_us: the wait in micro seconds
+[Returns] : 1 after the wait, or 0 at once if the timer is stopped or the interrupts are disabled, the caller
+			then waits with a delay loop
+--------------------------------------------------------------------------------------------------------------- */
+EXTERN uint8 TIMER0_sleepUs(uint16 a_us);
+
+#endif /* TIMER_H_ */